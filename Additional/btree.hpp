@@ -0,0 +1,807 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:31:56 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 22:31:56 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_H
+# define BTREE_H
+
+# include <memory>
+# include <cstring>
+# include <iterator>
+# if __cplusplus >= 201103L
+#  include <utility>
+#  include "is_nothrow_relocatable.hpp"
+# endif
+# include "pair.hpp"
+# include "make_pair.hpp"
+# include "integral_constant.hpp"
+# include "is_trivially_relocatable.hpp"
+# include "reverse_iterator.hpp"
+# include "btree_node.hpp"
+# include "btree_iterator.hpp"
+# include "node_pool_allocator.hpp"
+
+namespace ft
+{
+
+
+/* Same contract as red_black_tree, but every node packs up to node_values values in about NodeBytes bytes:
+   a lookup touches one node per level and an in-order scan reads the values contiguously. Inserting and erasing
+   move values between nodes ==> they invalidate every iterator. Moving a value must not throw, or a node would be
+   left half shifted: the value is built before any node changes, and the moves between nodes can't fail. */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator = std::allocator<T>, std::size_t NodeBytes = 256>
+class btree {
+
+public:
+	typedef	T																value_type;
+	typedef	T*																pointer;
+	typedef	const T*														const_pointer;
+	typedef	T&																reference;
+	typedef	const T&														const_reference;
+	typedef ft::btree_node<value_type, NodeBytes>							node_type;
+	typedef ft::btree_node<value_type, NodeBytes>*							link_type;
+	typedef ft::btree_internal_node<value_type, NodeBytes>					internal_node_type;
+	typedef ft::btree_iterator<value_type, node_type>						iterator;
+	typedef ft::const_btree_iterator<value_type, node_type>					const_iterator;
+	typedef ft::reverse_iterator<iterator>									reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>							const_reverse_iterator;
+	typedef	KeyOfValue														key_of_value;
+	typedef	typename KeyOfValue::result_type								key_type;
+	typedef	Compare															compare_type;
+	typedef	typename Allocator::template rebind<value_type>::other			allocator_type;
+	typedef	typename Allocator::template rebind<node_type>::other			leaf_allocator_type;
+	typedef	typename Allocator::template rebind<internal_node_type>::other	internal_allocator_type;
+	typedef	std::ptrdiff_t													difference_type;
+	typedef std::size_t														size_type;
+
+# if __cplusplus >= 201103L
+	static_assert(ft::is_nothrow_relocatable<value_type>::value, "btree values need a noexcept move constructor, or a specialization of ft::is_trivially_relocatable");
+# endif
+
+	const static size_type	node_values = node_type::slots;
+	const static size_type	min_node_values = node_values / 2;
+
+	btree(const compare_type& compare = compare_type(), const allocator_type& alloc = allocator_type());
+	btree(const btree& other);
+	~btree();
+
+	btree&								operator = (const btree& other);
+
+	iterator							begin();
+	iterator							end();
+	const_iterator						begin() const;
+	const_iterator						end() const;
+	reverse_iterator					rbegin();
+	reverse_iterator					rend();
+	const_reverse_iterator				rbegin() const;
+	const_reverse_iterator				rend() const;
+
+	ft::pair<iterator, bool>			insert_unique(const value_type& value);
+	ft::pair<iterator, bool>			insert(iterator hint, const value_type& value);
+	template <typename InputIterator>
+	void								insert_range(InputIterator first, InputIterator last);
+	template <typename InputIterator>
+	void								insert_sorted(InputIterator first, InputIterator last);
+	template <typename Key>
+	ft::pair<iterator, bool>			find_position(const Key& key);
+# if __cplusplus >= 201103L
+	template <typename... Args>
+	iterator							insert_at(iterator position, Args&&... args);
+# else
+	iterator							insert_at(iterator position, const value_type& value);
+	template <typename U1, typename U2>
+	iterator							insert_at(iterator position, const U1& first, const U2& second);
+# endif
+	void								erase(iterator position);
+
+	void								clear(void);
+
+	size_type							size(void) const;
+
+	template <typename Key>
+	iterator							find(const Key& key);
+	template <typename Key>
+	const_iterator						find(const Key& key) const;
+	template <typename Key>
+	iterator							lower_bound(const Key& key);
+	template <typename Key>
+	const_iterator						lower_bound(const Key& key) const;
+	template <typename Key>
+	iterator							upper_bound(const Key& key);
+	template <typename Key>
+	const_iterator						upper_bound(const Key& key) const;
+
+	link_type					_root;
+	link_type					_leftmost;
+	link_type					_rightmost;
+	size_type					_size;
+	compare_type				_compare;
+	allocator_type				_alloc;
+	leaf_allocator_type			_leaf_alloc;
+	internal_allocator_type		_internal_alloc;
+
+private:
+	static const key_type&				key_of(const value_type& value);
+
+	template <typename Key>
+	size_type							node_lower_bound(const node_type* node, const Key& key) const;
+	template <typename Key>
+	size_type							node_upper_bound(const node_type* node, const Key& key) const;
+
+	link_type							make_room(iterator& position);
+	void								split(link_type& node, size_type& position);
+
+	void								rebalance_after_erase(link_type node);
+	void								merge_nodes(link_type left, link_type right);
+	void								rotate_left(link_type left, link_type right, size_type count);
+	void								rotate_right(link_type left, link_type right, size_type count);
+
+	void								relocate(value_type* dest, value_type* first, value_type* last);
+	void								__relocate(value_type* dest, value_type* first, value_type* last, ft::true_type);
+	void								__relocate(value_type* dest, value_type* first, value_type* last, ft::false_type);
+	template <typename U>
+	void								move_value(U* dest, U& src);
+	template <typename U1, typename U2>
+	void								move_value(ft::pair<U1, U2>* dest, ft::pair<U1, U2>& src);
+	void								move_children(link_type dest, size_type dest_index, link_type src, size_type first, size_type last);
+
+	link_type							new_node(bool leaf);
+	void								delete_node(link_type node);
+	link_type							copy_tree(const node_type* src);
+	void								clear_tree(link_type node);
+};
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::btree(const compare_type& compare, const allocator_type& alloc) : _root(nullptr), _leftmost(nullptr), _rightmost(nullptr), _size(0), _compare(compare), _alloc(alloc), _leaf_alloc(alloc), _internal_alloc(alloc) { }
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::btree(const btree& other) : _root(nullptr), _leftmost(nullptr), _rightmost(nullptr), _size(0), _compare(other._compare), _alloc(ft::select_on_container_copy_construction(other._alloc)), _leaf_alloc(_alloc), _internal_alloc(_alloc) {
+	if (other._root)
+		_root = copy_tree(other._root);
+	_size = other._size;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::~btree() {
+	clear();
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree<T, KeyOfValue, Compare, Allocator, NodeBytes>& btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::operator = (const btree& other) {
+	if (this == &other)
+		return *this;
+	clear();
+	_compare = other._compare;
+	if (other._root)
+		_root = copy_tree(other._root);
+	_size = other._size;
+	return *this;
+}
+
+/* ITERATORS START --> */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::begin() {
+	return iterator(_leftmost, 0);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::end() {
+	return iterator(_rightmost, _rightmost ? _rightmost->count : 0);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::const_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::begin() const {
+	return const_iterator(_leftmost, 0);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::const_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::end() const {
+	return const_iterator(_rightmost, _rightmost ? _rightmost->count : 0);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::reverse_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::rbegin() {
+	return reverse_iterator(end());
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::reverse_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::rend() {
+	return reverse_iterator(begin());
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::const_reverse_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::rbegin() const {
+	return const_reverse_iterator(end());
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::const_reverse_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::rend() const {
+	return const_reverse_iterator(begin());
+}
+
+/* <-- ITERATORS END */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+ft::pair<typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator, bool> btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::insert(iterator hint, const value_type& value) {
+	iterator	neighbour = hint;
+
+	if (!_root)
+		return ft::make_pair(insert_at(hint, value), true);
+
+	/* The value belongs right before the hint ==> it must also be greater than the hint's predecessor */
+
+	if (hint == end() || _compare(key_of(value), key_of(*hint))) {
+		if (hint == begin() || _compare(key_of(*--neighbour), key_of(value)))
+			return ft::make_pair(insert_at(hint, value), true);
+		return insert_unique(value);
+	}
+
+	/* The value belongs right after the hint ==> it must also be less than the hint's successor */
+
+	if (_compare(key_of(*hint), key_of(value))) {
+		if (++neighbour == end() || _compare(key_of(value), key_of(*neighbour)))
+			return ft::make_pair(insert_at(neighbour, value), true);
+		return insert_unique(value);
+	}
+	return ft::make_pair(hint, false);
+}
+
+/* Appending in order goes through the end() hint: one comparison and no descent per value, and the leaves
+   split so that they stay full. Anything out of order falls back to a regular insert. */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename InputIterator>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::insert_range(InputIterator first, InputIterator last) {
+	for (; first != last; ++first)
+		insert(end(), *first);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename InputIterator>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::insert_sorted(InputIterator first, InputIterator last) {
+	insert_range(first, last);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+ft::pair<typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator, bool> btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::find_position(const Key& key) {
+	link_type	node = _root;
+	size_type	index = 0;
+
+	/* Return the value equal to key, || the leaf position where it would be inserted */
+
+	if (!node)
+		return ft::make_pair(end(), false);
+	while (true) {
+		index = node_lower_bound(node, key);
+		if (index < node->count && !_compare(key, key_of(*node->value(index))))
+			return ft::make_pair(iterator(node, index), true);
+		if (node->leaf)
+			return ft::make_pair(iterator(node, index), false);
+		node = node->child(index);
+	}
+}
+
+# if __cplusplus >= 201103L
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename... Args>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::insert_at(iterator position, Args&&... args) {
+	value_type	value(std::forward<Args>(args)...);
+	link_type	node = make_room(position);
+
+	move_value(node->value(position._position), value);
+	++node->count;
+	++_size;
+	return position;
+}
+
+# else
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::insert_at(iterator position, const value_type& value) {
+	link_type	node = make_room(position);
+
+	_alloc.construct(node->value(position._position), value);
+	++node->count;
+	++_size;
+	return position;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename U1, typename U2>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::insert_at(iterator position, const U1& first, const U2& second) {
+	value_type	value(first, second);
+	link_type	node = make_room(position);
+
+	move_value(node->value(position._position), value);
+	++node->count;
+	++_size;
+	return position;
+}
+
+# endif
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::erase(iterator position) {
+	link_type	node = position._node;
+	size_type	index = position._position;
+	link_type	leaf = nullptr;
+
+	if (!node || index >= node->count)
+		return ;
+	_alloc.destroy(node->value(index));
+
+	/* An internal value is replaced by its predecessor, the last value of a leaf ==> values only leave leaves */
+
+	if (!node->leaf) {
+		leaf = node->child(index);
+		while (!leaf->leaf)
+			leaf = leaf->child(leaf->count);
+		relocate(node->value(index), leaf->value(leaf->count - 1), leaf->value(leaf->count));
+		node = leaf;
+	}
+	else
+		relocate(node->value(index), node->value(index + 1), node->value(node->count));
+	--node->count;
+	--_size;
+	rebalance_after_erase(node);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::clear(void) {
+	if (_root)
+		clear_tree(_root);
+	_root = nullptr;
+	_leftmost = nullptr;
+	_rightmost = nullptr;
+	_size = 0;
+	ft::release_storage(_leaf_alloc);
+	ft::release_storage(_internal_alloc);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::size_type btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::size(void) const {
+	return _size;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::find(const Key& key) {
+	ft::pair<iterator, bool>	position = find_position(key);
+
+	return position.second ? position.first : end();
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::const_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::find(const Key& key) const {
+	return const_cast<btree*>(this)->find(key);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::lower_bound(const Key& key) {
+	link_type	node = _root;
+	size_type	index = 0;
+	iterator	result = end();
+
+	/* Every value met on the way down that is not less than key is a better candidate than the previous one */
+
+	while (node) {
+		index = node_lower_bound(node, key);
+		if (index < node->count)
+			result = iterator(node, index);
+		if (node->leaf)
+			break ;
+		node = node->child(index);
+	}
+	return result;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::const_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::lower_bound(const Key& key) const {
+	return const_cast<btree*>(this)->lower_bound(key);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::upper_bound(const Key& key) {
+	link_type	node = _root;
+	size_type	index = 0;
+	iterator	result = end();
+
+	while (node) {
+		index = node_upper_bound(node, key);
+		if (index < node->count)
+			result = iterator(node, index);
+		if (node->leaf)
+			break ;
+		node = node->child(index);
+	}
+	return result;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::const_iterator btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::upper_bound(const Key& key) const {
+	return const_cast<btree*>(this)->upper_bound(key);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+const typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::key_type& btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::key_of(const value_type& value) {
+	return KeyOfValue()(value);
+}
+
+/* Binary searches inside one node: the first value not less than key, the first value greater than key */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::size_type btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::node_lower_bound(const node_type* node, const Key& key) const {
+	size_type	first = 0;
+	size_type	length = node->count;
+	size_type	half = 0;
+
+	while (length) {
+		half = length / 2;
+		if (_compare(key_of(*node->value(first + half)), key)) {
+			first += half + 1;
+			length -= half + 1;
+		}
+		else
+			length = half;
+	}
+	return first;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename Key>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::size_type btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::node_upper_bound(const node_type* node, const Key& key) const {
+	size_type	first = 0;
+	size_type	length = node->count;
+	size_type	half = 0;
+
+	while (length) {
+		half = length / 2;
+		if (!_compare(key, key_of(*node->value(first + half)))) {
+			first += half + 1;
+			length -= half + 1;
+		}
+		else
+			length = half;
+	}
+	return first;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+ft::pair<typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::iterator, bool> btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::insert_unique(const value_type& value) {
+	ft::pair<iterator, bool>	position = find_position(key_of(value));
+
+	if (position.second)
+		return ft::make_pair(position.first, false);
+	return ft::make_pair(insert_at(position.first, value), true);
+}
+
+/* Turns position into a free slot of a leaf, splitting full nodes on the way. Returns the leaf, position is updated */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::link_type btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::make_room(iterator& position) {
+	link_type	node = position._node;
+	size_type	index = position._position;
+
+	if (!_root) {
+		_root = new_node(true);
+		_leftmost = _root;
+		_rightmost = _root;
+		node = _root;
+		index = 0;
+	}
+
+	/* Right before an internal value ==> right after its predecessor, which ends a leaf */
+
+	else if (!node->leaf) {
+		--position;
+		node = position._node;
+		index = position._position + 1;
+	}
+	if (node->count == node_values)
+		split(node, index);
+	relocate(node->value(index + 1), node->value(index), node->value(node->count));
+	position = iterator(node, index);
+	return node;
+}
+
+/* Splits the full node so that a value fits at position: the median moves up to the parent, which is split
+   first if it is full too. Appending at either end leaves the other half full, so sorted input packs the nodes.
+   node and position are updated to the half that receives the value. */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::split(link_type& node, size_type& position) {
+	link_type	parent = node->parent;
+	link_type	sibling = new_node(node->leaf);
+	size_type	keep = node_values / 2;
+	size_type	index = 0;
+
+	/* Every node is allocated before any of them changes, so a bad_alloc leaves the tree as it was */
+
+	try {
+		if (!parent) {
+			parent = new_node(false);
+			parent->set_child(0, node);
+			_root = parent;
+		}
+		else if (parent->count == node_values) {
+			index = node->position;
+			split(parent, index);
+			parent = node->parent;
+		}
+	}
+	catch (...) {
+		delete_node(sibling);
+		throw;
+	}
+	if (position == node_values)
+		keep = node_values - 1;
+	else if (position == 0)
+		keep = 0;
+
+	/* The values after the median, and the children around them, go to the new right sibling */
+
+	relocate(sibling->value(0), node->value(keep + 1), node->value(node->count));
+	if (!node->leaf)
+		move_children(sibling, 0, node, keep + 1, node->count + 1);
+	sibling->count = node->count - keep - 1;
+
+	/* The median takes the place in the parent, right before the new sibling */
+
+	index = node->position;
+	relocate(parent->value(index + 1), parent->value(index), parent->value(parent->count));
+	move_children(parent, index + 2, parent, index + 1, parent->count + 1);
+	relocate(parent->value(index), node->value(keep), node->value(keep + 1));
+	parent->set_child(index + 1, sibling);
+	++parent->count;
+	node->count = keep;
+	if (node == _rightmost)
+		_rightmost = sibling;
+	if (position > keep) {
+		position -= keep + 1;
+		node = sibling;
+	}
+}
+
+/* Walks up from a node that lost a value: an underfull node merges with a sibling when both fit in one node,
+   else it takes values from the fuller sibling. An empty root gives its place to its only child. */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::rebalance_after_erase(link_type node) {
+	link_type	parent = nullptr;
+	link_type	left = nullptr;
+	link_type	right = nullptr;
+
+	while (node != _root && node->count < min_node_values) {
+		parent = node->parent;
+		left = node->position > 0 ? parent->child(node->position - 1) : nullptr;
+		right = node->position < parent->count ? parent->child(node->position + 1) : nullptr;
+		if (left && left->count + node->count < node_values)
+			merge_nodes(left, node);
+		else if (right && node->count + right->count < node_values)
+			merge_nodes(node, right);
+		else if (right && (!left || right->count >= left->count)) {
+			rotate_left(node, right, (right->count - node->count) / 2);
+			break ;
+		}
+		else {
+			rotate_right(left, node, (left->count - node->count) / 2);
+			break ;
+		}
+		node = parent;
+	}
+	if (_root->count)
+		return ;
+	node = _root;
+	if (node->leaf) {
+		_root = nullptr;
+		_leftmost = nullptr;
+		_rightmost = nullptr;
+	}
+	else {
+		_root = node->child(0);
+		_root->parent = nullptr;
+		_root->position = 0;
+	}
+	delete_node(node);
+}
+
+/* Moves the separator and every value of right at the end of left, then drops right */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::merge_nodes(link_type left, link_type right) {
+	link_type	parent = left->parent;
+	size_type	index = left->position;
+
+	relocate(left->value(left->count), parent->value(index), parent->value(index + 1));
+	relocate(left->value(left->count + 1), right->value(0), right->value(right->count));
+	if (!left->leaf)
+		move_children(left, left->count + 1, right, 0, right->count + 1);
+	left->count += right->count + 1;
+	relocate(parent->value(index), parent->value(index + 1), parent->value(parent->count));
+	move_children(parent, index + 1, parent, index + 2, parent->count + 1);
+	--parent->count;
+	if (right == _rightmost)
+		_rightmost = left;
+	right->count = 0;
+	delete_node(right);
+}
+
+/* Moves count values from right to left through the separator between them */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::rotate_left(link_type left, link_type right, size_type count) {
+	link_type	parent = left->parent;
+	size_type	index = left->position;
+
+	if (!count)
+		count = 1;
+	relocate(left->value(left->count), parent->value(index), parent->value(index + 1));
+	relocate(left->value(left->count + 1), right->value(0), right->value(count - 1));
+	relocate(parent->value(index), right->value(count - 1), right->value(count));
+	relocate(right->value(0), right->value(count), right->value(right->count));
+	if (!left->leaf) {
+		move_children(left, left->count + 1, right, 0, count);
+		move_children(right, 0, right, count, right->count + 1);
+	}
+	left->count += count;
+	right->count -= count;
+}
+
+/* Moves count values from left to right through the separator between them */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::rotate_right(link_type left, link_type right, size_type count) {
+	link_type	parent = left->parent;
+	size_type	index = left->position;
+
+	if (!count)
+		count = 1;
+	relocate(right->value(count), right->value(0), right->value(right->count));
+	relocate(right->value(count - 1), parent->value(index), parent->value(index + 1));
+	relocate(right->value(0), left->value(left->count - count + 1), left->value(left->count));
+	relocate(parent->value(index), left->value(left->count - count), left->value(left->count - count + 1));
+	if (!left->leaf) {
+		move_children(right, count, right, 0, right->count + 1);
+		move_children(right, 0, left, left->count - count + 1, left->count + 1);
+	}
+	left->count -= count;
+	right->count += count;
+}
+
+/* Moves the values of [first, last) to dest, the ranges may overlap. The source slots are left unconstructed */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::relocate(value_type* dest, value_type* first, value_type* last) {
+	typedef typename ft::is_trivially_relocatable<value_type>::type	_Relocatable;
+	__relocate(dest, first, last, _Relocatable());
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::__relocate(value_type* dest, value_type* first, value_type* last, ft::true_type) {
+	if (first < last)
+		std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof (value_type));
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::__relocate(value_type* dest, value_type* first, value_type* last, ft::false_type) {
+	if (dest < first) {
+		for (; first != last; ++first, ++dest) {
+			move_value(dest, *first);
+			_alloc.destroy(first);
+		}
+		return ;
+	}
+	for (dest += last - first; last != first; ) {
+		--last;
+		--dest;
+		move_value(dest, *last);
+		_alloc.destroy(last);
+	}
+}
+
+/* Builds dest out of src, which is dropped right after ==> the key of a pair is moved too, despite being const */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename U>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::move_value(U* dest, U& src) {
+# if __cplusplus >= 201103L
+	_alloc.construct(dest, std::move(src));
+# else
+	_alloc.construct(dest, src);
+# endif
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename U1, typename U2>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::move_value(ft::pair<U1, U2>* dest, ft::pair<U1, U2>& src) {
+# if __cplusplus >= 201103L
+	_alloc.construct(dest, std::move(const_cast<typename std::remove_const<U1>::type&>(src.first)), std::move(const_cast<typename std::remove_const<U2>::type&>(src.second)));
+# else
+	_alloc.construct(dest, src);
+# endif
+}
+
+/* Moves the children [first, last) of src to dest from dest_index on, the ranges may overlap */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::move_children(link_type dest, size_type dest_index, link_type src, size_type first, size_type last) {
+	if (dest != src || dest_index < first) {
+		for (; first < last; ++first, ++dest_index)
+			dest->set_child(dest_index, src->child(first));
+		return ;
+	}
+	for (dest_index += last - first; last > first; )
+		dest->set_child(--dest_index, src->child(--last));
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::link_type btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::new_node(bool leaf) {
+	link_type	node = nullptr;
+
+	if (leaf)
+		node = _leaf_alloc.allocate(1);
+	else
+		node = _internal_alloc.allocate(1);
+	node->reset(leaf);
+	return node;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::delete_node(link_type node) {
+	if (node->leaf)
+		_leaf_alloc.deallocate(node, 1);
+	else
+		_internal_alloc.deallocate(static_cast<internal_node_type*>(node), 1);
+}
+
+/* Copies src with its subtree, the leaves are met from left to right */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::link_type btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::copy_tree(const node_type* src) {
+	link_type	node = new_node(src->leaf);
+
+	for (; node->count < src->count; ++node->count)
+		_alloc.construct(node->value(node->count), *src->value(node->count));
+	if (node->leaf) {
+		if (!_leftmost)
+			_leftmost = node;
+		_rightmost = node;
+		return node;
+	}
+	for (size_type i = 0; i <= src->count; ++i)
+		node->set_child(i, copy_tree(src->child(i)));
+	return node;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree<T, KeyOfValue, Compare, Allocator, NodeBytes>::clear_tree(link_type node) {
+	for (size_type i = 0; i < node->count; ++i)
+		_alloc.destroy(node->value(i));
+	if (!node->leaf)
+		for (size_type i = 0; i <= node->count; ++i)
+			clear_tree(node->child(i));
+	delete_node(node);
+}
+
+
+} /* FT NAMESPACE */
+
+#endif /* BTREE_H */
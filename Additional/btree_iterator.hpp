@@ -0,0 +1,372 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_iterator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:24:09 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 22:24:09 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_ITERATOR_H
+# define BTREE_ITERATOR_H
+
+# include <cstddef>
+# include <iterator>
+
+namespace ft
+{
+
+
+/* A position is a node and an index in it, end() is one past the last value of the rightmost leaf */
+
+template <typename T, typename Node>
+class btree_iterator {
+
+public:
+	typedef	Node*								iterator;
+	typedef	T									value_type;
+	typedef	T*									pointer;
+	typedef	T&									reference;
+	typedef	std::ptrdiff_t						difference_type;
+	typedef	std::bidirectional_iterator_tag		iterator_category;
+
+	btree_iterator(iterator node = iterator(), std::size_t position = 0);
+	btree_iterator(const btree_iterator& other);
+	~btree_iterator();
+
+	btree_iterator&		operator = (const btree_iterator& other);
+
+	reference			operator * (void) const;
+	pointer				operator -> (void) const;
+
+	btree_iterator		operator ++ (int);
+	btree_iterator&		operator ++ (void);
+	btree_iterator		operator -- (int);
+	btree_iterator&		operator -- (void);
+
+	iterator		_node;
+	std::size_t		_position;
+
+protected:
+	void	increment(void);
+	void	decrement(void);
+};
+
+template <typename T, typename Node>
+btree_iterator<T, Node>::btree_iterator(iterator node, std::size_t position) : _node(node), _position(position) { }
+
+template <typename T, typename Node>
+btree_iterator<T, Node>::btree_iterator(const btree_iterator& other) : _node(other._node), _position(other._position) { }
+
+template <typename T, typename Node>
+btree_iterator<T, Node>::~btree_iterator() { }
+
+template <typename T, typename Node>
+btree_iterator<T, Node>& btree_iterator<T, Node>::operator = (const btree_iterator& other) {
+	_node = other._node;
+	_position = other._position;
+	return *this;
+}
+
+template <typename T, typename Node>
+typename btree_iterator<T, Node>::reference btree_iterator<T, Node>::operator * (void) const {
+	return *_node->value(_position);
+}
+
+template <typename T, typename Node>
+typename btree_iterator<T, Node>::pointer btree_iterator<T, Node>::operator -> (void) const {
+	return _node->value(_position);
+}
+
+template <typename T, typename Node>
+btree_iterator<T, Node> btree_iterator<T, Node>::operator ++ (int) {
+	btree_iterator	copy(*this);
+
+	increment();
+	return copy;
+}
+
+template <typename T, typename Node>
+btree_iterator<T, Node>& btree_iterator<T, Node>::operator ++ (void) {
+	increment();
+	return *this;
+}
+
+template <typename T, typename Node>
+btree_iterator<T, Node> btree_iterator<T, Node>::operator -- (int) {
+	btree_iterator	copy(*this);
+
+	decrement();
+	return copy;
+}
+
+template <typename T, typename Node>
+btree_iterator<T, Node>& btree_iterator<T, Node>::operator -- (void) {
+	decrement();
+	return *this;
+}
+
+template <typename T, typename Node>
+void btree_iterator<T, Node>::increment(void) {
+	iterator	node = _node;
+	std::size_t	position = _position;
+
+	/* Inside a leaf ==> the next value is right there */
+
+	if (_node->leaf) {
+		if (++_position < _node->count)
+			return ;
+
+		/* Past the leaf ==> climb until the subtree is left through a value, none means end() */
+
+		while (_node->parent && _position == _node->count) {
+			_position = _node->position;
+			_node = _node->parent;
+		}
+		if (_position == _node->count) {
+			_node = node;
+			_position = position + 1;
+		}
+		return ;
+	}
+
+	/* Internal value ==> the next one is the leftmost value of the right subtree */
+
+	_node = _node->child(_position + 1);
+	while (!_node->leaf)
+		_node = _node->child(0);
+	_position = 0;
+}
+
+template <typename T, typename Node>
+void btree_iterator<T, Node>::decrement(void) {
+	iterator	node = _node;
+	std::size_t	position = _position;
+
+	if (_node->leaf) {
+		if (_position > 0) {
+			--_position;
+			return ;
+		}
+		while (_node->parent && _position == 0) {
+			_position = _node->position;
+			_node = _node->parent;
+		}
+		if (_position == 0) {
+			_node = node;
+			_position = position;
+			return ;
+		}
+		--_position;
+		return ;
+	}
+
+	/* Internal value ==> the previous one is the rightmost value of the left subtree */
+
+	_node = _node->child(_position);
+	while (!_node->leaf)
+		_node = _node->child(_node->count);
+	_position = _node->count - 1;
+}
+
+template <typename _T, typename _Node>
+bool operator == (const btree_iterator<_T, _Node>& lhs, const btree_iterator<_T, _Node>& rhs) {
+	return (lhs._node == rhs._node && lhs._position == rhs._position);
+}
+
+template <typename _T, typename _Node>
+bool operator != (const btree_iterator<_T, _Node>& lhs, const btree_iterator<_T, _Node>& rhs) {
+	return !(lhs == rhs);
+}
+
+
+template <typename T, typename Node>
+class const_btree_iterator {
+
+public:
+	typedef	const Node*							iterator;
+	typedef	T									value_type;
+	typedef	const T*							pointer;
+	typedef	const T&							reference;
+	typedef	std::ptrdiff_t						difference_type;
+	typedef	std::bidirectional_iterator_tag		iterator_category;
+
+	const_btree_iterator(iterator node = iterator(), std::size_t position = 0);
+	const_btree_iterator(const btree_iterator<T, Node>& other);
+	const_btree_iterator(const const_btree_iterator& other);
+	~const_btree_iterator();
+
+	const_btree_iterator&	operator = (const const_btree_iterator& other);
+	const_btree_iterator&	operator = (const btree_iterator<T, Node>& other);
+
+	reference				operator * (void) const;
+	pointer					operator -> (void) const;
+
+	const_btree_iterator&	operator ++ (void);
+	const_btree_iterator	operator ++ (int);
+	const_btree_iterator&	operator -- (void);
+	const_btree_iterator	operator -- (int);
+
+	iterator		_node;
+	std::size_t		_position;
+
+protected:
+	void	increment(void);
+	void	decrement(void);
+};
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>::const_btree_iterator(iterator node, std::size_t position) : _node(node), _position(position) { }
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>::const_btree_iterator(const btree_iterator<T, Node>& other) : _node(other._node), _position(other._position) { }
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>::const_btree_iterator(const const_btree_iterator& other) : _node(other._node), _position(other._position) { }
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>::~const_btree_iterator() { }
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>& const_btree_iterator<T, Node>::operator = (const const_btree_iterator& other) {
+	_node = other._node;
+	_position = other._position;
+	return *this;
+}
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>& const_btree_iterator<T, Node>::operator = (const btree_iterator<T, Node>& other) {
+	_node = other._node;
+	_position = other._position;
+	return *this;
+}
+
+template <typename T, typename Node>
+typename const_btree_iterator<T, Node>::reference const_btree_iterator<T, Node>::operator * (void) const {
+	return *_node->value(_position);
+}
+
+template <typename T, typename Node>
+typename const_btree_iterator<T, Node>::pointer const_btree_iterator<T, Node>::operator -> (void) const {
+	return _node->value(_position);
+}
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node> const_btree_iterator<T, Node>::operator ++ (int) {
+	const_btree_iterator	copy(*this);
+
+	increment();
+	return copy;
+}
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>& const_btree_iterator<T, Node>::operator ++ (void) {
+	increment();
+	return *this;
+}
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node> const_btree_iterator<T, Node>::operator -- (int) {
+	const_btree_iterator	copy(*this);
+
+	decrement();
+	return copy;
+}
+
+template <typename T, typename Node>
+const_btree_iterator<T, Node>& const_btree_iterator<T, Node>::operator -- (void) {
+	decrement();
+	return *this;
+}
+
+template <typename T, typename Node>
+void const_btree_iterator<T, Node>::increment(void) {
+	iterator	node = _node;
+	std::size_t	position = _position;
+
+	if (_node->leaf) {
+		if (++_position < _node->count)
+			return ;
+		while (_node->parent && _position == _node->count) {
+			_position = _node->position;
+			_node = _node->parent;
+		}
+		if (_position == _node->count) {
+			_node = node;
+			_position = position + 1;
+		}
+		return ;
+	}
+	_node = _node->child(_position + 1);
+	while (!_node->leaf)
+		_node = _node->child(0);
+	_position = 0;
+}
+
+template <typename T, typename Node>
+void const_btree_iterator<T, Node>::decrement(void) {
+	iterator	node = _node;
+	std::size_t	position = _position;
+
+	if (_node->leaf) {
+		if (_position > 0) {
+			--_position;
+			return ;
+		}
+		while (_node->parent && _position == 0) {
+			_position = _node->position;
+			_node = _node->parent;
+		}
+		if (_position == 0) {
+			_node = node;
+			_position = position;
+			return ;
+		}
+		--_position;
+		return ;
+	}
+	_node = _node->child(_position);
+	while (!_node->leaf)
+		_node = _node->child(_node->count);
+	_position = _node->count - 1;
+}
+
+template <typename _T, typename _Node>
+bool operator == (const const_btree_iterator<_T, _Node>& lhs, const const_btree_iterator<_T, _Node>& rhs) {
+	return (lhs._node == rhs._node && lhs._position == rhs._position);
+}
+
+template <typename _T, typename _Node>
+bool operator != (const const_btree_iterator<_T, _Node>& lhs, const const_btree_iterator<_T, _Node>& rhs) {
+	return !(lhs == rhs);
+}
+
+
+
+template <typename _T, typename _Node>
+bool operator == (const btree_iterator<_T, _Node>& lhs, const const_btree_iterator<_T, _Node>& rhs) {
+	return (lhs._node == rhs._node && lhs._position == rhs._position);
+}
+
+template <typename _T, typename _Node>
+bool operator != (const btree_iterator<_T, _Node>& lhs, const const_btree_iterator<_T, _Node>& rhs) {
+	return !(lhs == rhs);
+}
+
+template <typename _T, typename _Node>
+bool operator == (const const_btree_iterator<_T, _Node>& lhs, const btree_iterator<_T, _Node>& rhs) {
+	return (lhs._node == rhs._node && lhs._position == rhs._position);
+}
+
+template <typename _T, typename _Node>
+bool operator != (const const_btree_iterator<_T, _Node>& lhs, const btree_iterator<_T, _Node>& rhs) {
+	return !(lhs == rhs);
+}
+
+
+} /* FT NAMESPACE */
+
+#endif /* BTREE_ITERATOR_H */
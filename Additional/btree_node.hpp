@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_node.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:10:41 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 22:10:41 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_NODE_H
+# define BTREE_NODE_H
+
+# include <cstddef>
+
+namespace ft
+{
+
+
+template <typename T, std::size_t NodeBytes>
+class btree_internal_node;
+
+/* A B-tree node keeps up to `slots` sorted values side by side in about NodeBytes bytes. The values are raw
+   storage: the tree constructs, moves and destroys them, a node only knows how many of them are alive. */
+
+template <typename T, std::size_t NodeBytes>
+class btree_node {
+
+public:
+	typedef T						value_type;
+	typedef std::size_t				size_type;
+	typedef btree_node<T, NodeBytes>*	link_type;
+
+	const static size_type	slots = ((NodeBytes - 2 * sizeof (void*)) / sizeof (T) > 3 ? (NodeBytes - 2 * sizeof (void*)) / sizeof (T) : 3);
+
+	void				reset(bool is_leaf);
+
+	value_type*			value(size_type index);
+	const value_type*	value(size_type index) const;
+
+	/* Internal nodes only */
+
+	link_type			child(size_type index) const;
+	void				set_child(size_type index, link_type node);
+
+	link_type		parent;
+	unsigned short	position;
+	unsigned short	count;
+	bool			leaf;
+
+private:
+	union storage {
+		char		bytes[slots * sizeof (T)];
+		long double	align_float;
+		long long	align_int;
+		void*		align_pointer;
+	};
+
+	storage		_storage;
+};
+
+/* An internal node holds count + 1 children around its values, children[i] holds the values less than value(i) */
+
+template <typename T, std::size_t NodeBytes>
+class btree_internal_node : public btree_node<T, NodeBytes> {
+
+public:
+	typedef typename btree_node<T, NodeBytes>::link_type	link_type;
+
+	link_type	children[btree_node<T, NodeBytes>::slots + 1];
+};
+
+template <typename T, std::size_t NodeBytes>
+void btree_node<T, NodeBytes>::reset(bool is_leaf) {
+	parent = nullptr;
+	position = 0;
+	count = 0;
+	leaf = is_leaf;
+}
+
+template <typename T, std::size_t NodeBytes>
+typename btree_node<T, NodeBytes>::value_type* btree_node<T, NodeBytes>::value(size_type index) {
+	return reinterpret_cast<value_type*>(_storage.bytes) + index;
+}
+
+template <typename T, std::size_t NodeBytes>
+const typename btree_node<T, NodeBytes>::value_type* btree_node<T, NodeBytes>::value(size_type index) const {
+	return reinterpret_cast<const value_type*>(_storage.bytes) + index;
+}
+
+template <typename T, std::size_t NodeBytes>
+typename btree_node<T, NodeBytes>::link_type btree_node<T, NodeBytes>::child(size_type index) const {
+	return static_cast<const btree_internal_node<T, NodeBytes>*>(this)->children[index];
+}
+
+template <typename T, std::size_t NodeBytes>
+void btree_node<T, NodeBytes>::set_child(size_type index, link_type node) {
+	static_cast<btree_internal_node<T, NodeBytes>*>(this)->children[index] = node;
+	node->parent = this;
+	node->position = index;
+}
+
+
+} /* FT NAMESPACE */
+
+#endif /* BTREE_NODE_H */
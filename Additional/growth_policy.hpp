@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   growth_policy.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 12:58:06 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 12:58:06 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef GROWTH_POLICY_H
+# define GROWTH_POLICY_H
+
+# include <cstddef>
+
+namespace ft
+{
+
+
+/* A growth policy tells a container how much capacity to allocate when it runs out of room.
+   next_capacity(capacity, required) receives the current capacity and the minimum capacity needed,
+   and returns a value that is at least required. */
+
+/* Multiplies the capacity by Num / Den: 2 / 1 doubles, 3 / 2 grows by half */
+
+template <std::size_t Num = 2, std::size_t Den = 1>
+class geometric_growth {
+
+public:
+	static std::size_t	next_capacity(std::size_t capacity, std::size_t required) {
+		std::size_t	grown = capacity + capacity * (Num - Den) / Den;
+
+		if (grown <= capacity)
+			grown = capacity + 1;
+		return grown < required ? required : grown;
+	}
+};
+
+/* Rounds the capacity up to the next power of two, which lines up with the size classes of most allocators */
+
+class power_of_two_growth {
+
+public:
+	static std::size_t	next_capacity(std::size_t capacity, std::size_t required) {
+		std::size_t	grown = 1;
+
+		(void)capacity;
+		while (grown < required && grown << 1)
+			grown <<= 1;
+		return grown < required ? required : grown;
+	}
+};
+
+/* Grows by a fixed number of elements at a time: linear growth for memory-capped uses */
+
+template <std::size_t Chunk>
+class chunk_growth {
+
+public:
+	static std::size_t	next_capacity(std::size_t capacity, std::size_t required) {
+		(void)capacity;
+		return (required + Chunk - 1) / Chunk * Chunk;
+	}
+};
+
+
+}; /* FT NAMESPACE */
+
+#endif /* GROWTH_POLICY_H */
@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   identity.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:02:31 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 18:02:31 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IDENTITY_H
+# define IDENTITY_H
+
+namespace ft
+{
+
+
+/* Key extractor for containers whose values are their own keys */
+
+template <typename T>
+class identity {
+
+public:
+	typedef T		argument_type;
+	typedef T		result_type;
+
+	const T& operator () (const T& x) const { return (x); }
+};
+
+
+} /* FT NAMESPACE */
+
+#endif /* IDENTITY_H */
@@ -0,0 +1,36 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   is_nothrow_relocatable.hpp                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:14:03 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 01:14:03 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IS_NOTHROW_RELOCATABLE_H
+# define IS_NOTHROW_RELOCATABLE_H
+
+# include <type_traits>
+# include "integral_constant.hpp"
+# include "is_trivially_relocatable.hpp"
+# include "pair.hpp"
+
+namespace ft
+{
+
+
+/* True when a T can be moved to a new address without throwing: it is trivially relocatable, or its move
+   constructor is noexcept. A pair is rebuilt from its moved members, the const key included. */
+
+template <typename T>	class is_nothrow_relocatable : public integral_constant<bool, is_trivially_relocatable<T>::value || std::is_nothrow_move_constructible<T>::value> {};
+
+template <typename T1, typename T2>	class is_nothrow_relocatable<ft::pair<T1, T2> > : public integral_constant<bool, is_trivially_relocatable<ft::pair<T1, T2> >::value
+	|| (std::is_nothrow_move_constructible<typename std::remove_const<T1>::type>::value && std::is_nothrow_move_constructible<typename std::remove_const<T2>::type>::value)> {};
+
+
+}; /* FT NAMESPACE */
+
+#endif /* IS_NOTHROW_RELOCATABLE_H */
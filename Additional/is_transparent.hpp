@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   is_transparent.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:02:31 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 18:02:31 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IS_TRANSPARENT_H
+# define IS_TRANSPARENT_H
+
+namespace ft
+{
+
+
+template <typename T>
+class void_type {
+
+public:
+	typedef void	type;
+};
+
+/* Result is enabled as member type `type` only if Compare declares `is_transparent`, so that a comparator can
+   be called with a key of another type. Key is unused: it keeps the check dependent on the lookup's key type. */
+
+template <typename Compare, typename Key, typename Result, typename Enable = void>
+class enable_if_transparent { };
+
+template <typename Compare, typename Key, typename Result>
+class enable_if_transparent<Compare, Key, Result, typename void_type<typename Compare::is_transparent>::type> {
+
+public:
+	typedef Result	type;
+};
+
+
+} /* FT NAMESPACE */
+
+#endif /* IS_TRANSPARENT_H */
@@ -0,0 +1,29 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   is_trivially_copyable.hpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 11:02:13 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 11:02:13 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IS_TRIVIALLY_COPYABLE_H
+# define IS_TRIVIALLY_COPYABLE_H
+
+# include "integral_constant.hpp"
+
+namespace ft
+{
+
+
+/* True when T can be copied with memcpy: no user-provided copy operations and a trivial destructor */
+
+template <typename T>	class is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> {};
+
+
+}; /* FT NAMESPACE */
+
+#endif /* IS_TRIVIALLY_COPYABLE_H */
@@ -0,0 +1,37 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   is_trivially_relocatable.hpp                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 12:14:37 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 12:14:37 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IS_TRIVIALLY_RELOCATABLE_H
+# define IS_TRIVIALLY_RELOCATABLE_H
+
+# include "integral_constant.hpp"
+# include "is_trivially_copyable.hpp"
+# include "pair.hpp"
+
+namespace ft
+{
+
+
+/* True when moving a T to a new address and dropping the old one is the same as a memcpy of its bytes.
+   Trivially copyable types are, other types may opt in with a specialization:
+   template <> class is_trivially_relocatable<MyType> : public ft::true_type {}; */
+
+template <typename T>	class is_trivially_relocatable : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+
+/* A pair is, as soon as both of its members are */
+
+template <typename T1, typename T2>	class is_trivially_relocatable<ft::pair<T1, T2> > : public integral_constant<bool, is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value> {};
+
+
+}; /* FT NAMESPACE */
+
+#endif /* IS_TRIVIALLY_RELOCATABLE_H */
@@ -17,7 +17,7 @@ namespace ft
 {
 
 
-template <typename T>
+template <typename T = void>
 class less {
 	
 public:	
@@ -28,6 +28,18 @@ public:
 	bool operator () (const T& lhs, const T& rhs) const { return (lhs < rhs); }
 };
 
+/* less<> compares any two types that have an operator <, and lets maps and sets look keys up without converting them */
+
+template <>
+class less<void> {
+
+public:
+	typedef void	is_transparent;
+
+	template <typename T, typename U>
+	bool operator () (const T& lhs, const U& rhs) const { return (lhs < rhs); }
+};
+
 
 } /* FT NAMESPACE */
 
@@ -0,0 +1,216 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   merge_iterator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:14:52 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 00:14:52 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MERGE_ITERATOR_H
+# define MERGE_ITERATOR_H
+
+# include <cstddef>
+# include <iterator>
+# include "iterator_traits.hpp"
+
+namespace ft
+{
+
+
+enum merge_operation {merge_union, merge_intersection, merge_difference};
+
+/* Forward iterator over the union, intersection || difference of two sorted ranges without duplicates.
+   Equal elements are taken from the first range, so a map keeps the mapped values of its left operand */
+
+template <typename Iterator, typename Compare>
+class merge_iterator {
+
+private:
+	/* MEMBER TYPES */
+
+	typedef typename ft::iterator_traits<Iterator>		traits_type;
+
+	enum source {first_range, second_range, both_ranges};
+
+public:
+	typedef std::forward_iterator_tag					iterator_category;
+	typedef std::ptrdiff_t								difference_type;
+	typedef Iterator									iterator_type;
+	typedef typename traits_type::value_type			value_type;
+	typedef typename traits_type::reference				reference;
+	typedef typename traits_type::pointer				pointer;
+
+	/* ASSIGNMENT */
+
+	merge_iterator(iterator_type first1, iterator_type last1, iterator_type first2, iterator_type last2, const Compare& comp, merge_operation operation);
+	merge_iterator(const merge_iterator& other);
+	~merge_iterator();
+
+	merge_iterator&		operator = (const merge_iterator& other);
+
+	/* MEMBER METHODS */
+
+	merge_iterator&		operator ++	(void);
+	merge_iterator		operator ++	(int);
+	reference			operator *	(void) const;
+	pointer				operator ->	(void) const;
+	bool				operator ==	(const merge_iterator& other) const;
+	bool				operator !=	(const merge_iterator& other) const;
+
+private:
+	void				settle(void);
+
+	/* ATTRIBUTES */
+
+	iterator_type		_first1;
+	iterator_type		_last1;
+	iterator_type		_first2;
+	iterator_type		_last2;
+	Compare				_compare;
+	merge_operation		_operation;
+	source				_source;
+};
+
+namespace detail
+{
+
+/* Whether looking the m elements of the smaller side up in the larger one, m * log(n) comparisons,
+   beats walking both, m + n comparisons */
+
+inline bool prefer_lookups(std::size_t smaller, std::size_t larger) {
+	std::size_t	depth = 1;
+
+	for (std::size_t n = larger; n >>= 1; )
+		++depth;
+	return (smaller * depth < smaller + larger);
+}
+
+} /* DETAIL NAMESPACE */
+
+/* ASSIGNMENT START --> */
+
+template <typename Iterator, typename Compare>
+merge_iterator<Iterator, Compare>::merge_iterator(iterator_type first1, iterator_type last1, iterator_type first2, iterator_type last2, const Compare& comp, merge_operation operation)
+	: _first1(first1), _last1(last1), _first2(first2), _last2(last2), _compare(comp), _operation(operation), _source(first_range) {
+	settle();
+}
+
+template <typename Iterator, typename Compare>
+merge_iterator<Iterator, Compare>::merge_iterator(const merge_iterator& other)
+	: _first1(other._first1), _last1(other._last1), _first2(other._first2), _last2(other._last2), _compare(other._compare), _operation(other._operation), _source(other._source) { }
+
+template <typename Iterator, typename Compare>
+merge_iterator<Iterator, Compare>::~merge_iterator() { }
+
+template <typename Iterator, typename Compare>
+merge_iterator<Iterator, Compare>& merge_iterator<Iterator, Compare>::operator = (const merge_iterator& other) {
+	_first1 = other._first1;
+	_last1 = other._last1;
+	_first2 = other._first2;
+	_last2 = other._last2;
+	_compare = other._compare;
+	_operation = other._operation;
+	_source = other._source;
+	return *this;
+}
+
+/* <-- ASSIGNMENT END */
+
+/* MEMBER METHODS START --> */
+
+template <typename Iterator, typename Compare>
+merge_iterator<Iterator, Compare>& merge_iterator<Iterator, Compare>::operator ++ (void) {
+	if (_source != second_range)
+		++_first1;
+	if (_source != first_range)
+		++_first2;
+	settle();
+	return *this;
+}
+
+template <typename Iterator, typename Compare>
+merge_iterator<Iterator, Compare> merge_iterator<Iterator, Compare>::operator ++ (int) {
+	merge_iterator	copy(*this);
+
+	++(*this);
+	return copy;
+}
+
+template <typename Iterator, typename Compare>
+typename merge_iterator<Iterator, Compare>::reference merge_iterator<Iterator, Compare>::operator * (void) const {
+	return (_source == second_range ? *_first2 : *_first1);
+}
+
+template <typename Iterator, typename Compare>
+typename merge_iterator<Iterator, Compare>::pointer merge_iterator<Iterator, Compare>::operator -> (void) const {
+	return &(operator*());
+}
+
+/* Both positions are compared: settle() moves a finished iterator to the end of both ranges */
+
+template <typename Iterator, typename Compare>
+bool merge_iterator<Iterator, Compare>::operator == (const merge_iterator& other) const {
+	return (_first1 == other._first1 && _first2 == other._first2);
+}
+
+template <typename Iterator, typename Compare>
+bool merge_iterator<Iterator, Compare>::operator != (const merge_iterator& other) const {
+	return !(*this == other);
+}
+
+/* Skips to the next element of the result and records which range it comes from */
+
+template <typename Iterator, typename Compare>
+void merge_iterator<Iterator, Compare>::settle(void) {
+	if (_operation == merge_union)
+	{
+		if (_first1 == _last1)
+			_source = second_range;
+		else if (_first2 == _last2 || _compare(*_first1, *_first2))
+			_source = first_range;
+		else if (_compare(*_first2, *_first1))
+			_source = second_range;
+		else
+			_source = both_ranges;
+		return ;
+	}
+	while (_first1 != _last1)
+	{
+		if (_first2 == _last2 || _compare(*_first1, *_first2))
+		{
+			if (_operation == merge_difference)
+			{
+				_source = first_range;
+				return ;
+			}
+			if (_first2 == _last2)
+				break ;
+			++_first1;
+		}
+		else if (_compare(*_first2, *_first1))
+			++_first2;
+		else if (_operation == merge_intersection)
+		{
+			_source = both_ranges;
+			return ;
+		}
+		else
+		{
+			++_first1;
+			++_first2;
+		}
+	}
+	_first1 = _last1;
+	_first2 = _last2;
+}
+
+/* <-- MEMBER METHODS END */
+
+
+} /* FT NAMESPACE */
+
+#endif /* MERGE_ITERATOR_H */
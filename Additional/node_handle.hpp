@@ -0,0 +1,225 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_handle.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:02:17 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 01:02:17 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_HANDLE_H
+# define NODE_HANDLE_H
+
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
+namespace ft
+{
+
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+class map;
+template <typename T, typename Compare, typename Allocator, typename Policy>
+class set;
+
+/* Owns a node taken out of a map || set, until it is inserted into another one || destroyed with the handle.
+   Tree supplies the node and allocator types, Mapped is only used by map handles. The node is freed with a copy
+   of its tree's allocator. Only map and set build handles out of nodes and take the nodes back: an empty handle
+   never holds one */
+
+template <typename Tree, typename Key, typename Mapped = Key>
+class node_handle {
+
+public:
+	/* MEMBER TYPES */
+
+	typedef Key									key_type;
+	typedef Mapped								mapped_type;
+	typedef typename Tree::value_type			value_type;
+	typedef typename Tree::allocator_type		allocator_type;
+	typedef typename Tree::link_type			link_type;
+	typedef typename Tree::key_of_value			key_of_value;
+
+	/* ASSIGNMENT */
+
+	node_handle();
+# if __cplusplus >= 201103L
+	node_handle(node_handle&& other);
+	node_handle(const node_handle& other) = delete;
+# else
+	node_handle(const node_handle& other);
+# endif
+	~node_handle();
+
+# if __cplusplus >= 201103L
+	node_handle&		operator = (node_handle&& other);
+	node_handle&		operator = (const node_handle& other) = delete;
+# else
+	node_handle&		operator = (const node_handle& other);
+# endif
+
+	/* MEMBER METHODS */
+
+	bool				empty(void) const;
+	value_type&			value(void) const;
+	key_type&			key(void) const;
+	mapped_type&		mapped(void) const;
+	allocator_type		get_allocator(void) const;
+	void				swap(node_handle& other);
+
+private:
+	template <typename K, typename T, typename Compare, typename Allocator, typename Policy>
+	friend class map;
+	template <typename T, typename Compare, typename Allocator, typename Policy>
+	friend class set;
+
+	node_handle(link_type node, const allocator_type& alloc);
+
+	link_type			release(void) const;
+
+	/* ATTRIBUTES: before C++11 a copy takes the node over, like std::auto_ptr, and insert gets a const handle */
+
+	mutable link_type	_node;
+	allocator_type		_alloc;
+};
+
+/* Result of inserting a node handle: where the key is, whether the node went in, || the handle if it didn't */
+
+template <typename Iterator, typename NodeHandle>
+class insert_return_type {
+
+public:
+	Iterator	position;
+	bool		inserted;
+	NodeHandle	node;
+};
+
+/* ASSIGNMENT START --> */
+
+template <typename Tree, typename Key, typename Mapped>
+node_handle<Tree, Key, Mapped>::node_handle() : _node(nullptr), _alloc() { }
+
+template <typename Tree, typename Key, typename Mapped>
+node_handle<Tree, Key, Mapped>::node_handle(link_type node, const allocator_type& alloc) : _node(node), _alloc(alloc) { }
+
+# if __cplusplus >= 201103L
+
+template <typename Tree, typename Key, typename Mapped>
+node_handle<Tree, Key, Mapped>::node_handle(node_handle&& other) : _node(other._node), _alloc(std::move(other._alloc)) {
+	other._node = nullptr;
+}
+
+# else
+
+template <typename Tree, typename Key, typename Mapped>
+node_handle<Tree, Key, Mapped>::node_handle(const node_handle& other) : _node(other._node), _alloc(other._alloc) {
+	other._node = nullptr;
+}
+
+# endif
+
+template <typename Tree, typename Key, typename Mapped>
+node_handle<Tree, Key, Mapped>::~node_handle() {
+	if (_node) {
+		_alloc.destroy(_node);
+		_alloc.deallocate(_node, 1);
+	}
+}
+
+# if __cplusplus >= 201103L
+
+template <typename Tree, typename Key, typename Mapped>
+node_handle<Tree, Key, Mapped>& node_handle<Tree, Key, Mapped>::operator = (node_handle&& other) {
+	if (this == &other)
+		return *this;
+	if (_node) {
+		_alloc.destroy(_node);
+		_alloc.deallocate(_node, 1);
+	}
+	_node = other._node;
+	_alloc = std::move(other._alloc);
+	other._node = nullptr;
+	return *this;
+}
+
+# else
+
+template <typename Tree, typename Key, typename Mapped>
+node_handle<Tree, Key, Mapped>& node_handle<Tree, Key, Mapped>::operator = (const node_handle& other) {
+	node_handle	tmp(other);
+
+	swap(tmp);
+	return *this;
+}
+
+# endif
+
+/* <-- ASSIGNMENT END */
+
+/* MEMBER METHODS START --> */
+
+template <typename Tree, typename Key, typename Mapped>
+bool node_handle<Tree, Key, Mapped>::empty(void) const {
+	return !_node;
+}
+
+template <typename Tree, typename Key, typename Mapped>
+typename node_handle<Tree, Key, Mapped>::value_type& node_handle<Tree, Key, Mapped>::value(void) const {
+	return _node->value;
+}
+
+/* The node is out of any tree ==> its key may change before it is inserted again */
+
+template <typename Tree, typename Key, typename Mapped>
+typename node_handle<Tree, Key, Mapped>::key_type& node_handle<Tree, Key, Mapped>::key(void) const {
+	return const_cast<key_type&>(key_of_value()(_node->value));
+}
+
+template <typename Tree, typename Key, typename Mapped>
+typename node_handle<Tree, Key, Mapped>::mapped_type& node_handle<Tree, Key, Mapped>::mapped(void) const {
+	return _node->value.second;
+}
+
+template <typename Tree, typename Key, typename Mapped>
+typename node_handle<Tree, Key, Mapped>::allocator_type node_handle<Tree, Key, Mapped>::get_allocator(void) const {
+	return _alloc;
+}
+
+template <typename Tree, typename Key, typename Mapped>
+void node_handle<Tree, Key, Mapped>::swap(node_handle& other) {
+	link_type		node = _node;
+# if __cplusplus >= 201103L
+	allocator_type	alloc(std::move(_alloc));
+
+	_alloc = std::move(other._alloc);
+	other._alloc = std::move(alloc);
+# else
+	allocator_type	alloc(_alloc);
+
+	_alloc = other._alloc;
+	other._alloc = alloc;
+# endif
+	_node = other._node;
+	other._node = node;
+}
+
+/* The node went into a tree, which now owns it ==> the handle is left empty */
+
+template <typename Tree, typename Key, typename Mapped>
+typename node_handle<Tree, Key, Mapped>::link_type node_handle<Tree, Key, Mapped>::release(void) const {
+	link_type	node = _node;
+
+	_node = nullptr;
+	return node;
+}
+
+/* <-- MEMBER METHODS END */
+
+
+} /* FT NAMESPACE */
+
+#endif /* NODE_HANDLE_H */
@@ -0,0 +1,359 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_pool_allocator.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:21:54 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 17:21:54 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_POOL_ALLOCATOR_H
+# define NODE_POOL_ALLOCATOR_H
+
+# include <new>
+# include <cstddef>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
+namespace ft
+{
+
+
+/* The pools shared by a node_pool_allocator and its copies: a rebound copy carves objects of another size ==>
+   one pool per slot size. Each pool carves its slots out of SlabBytes sized slabs and recycles them through a
+   freelist, the first slot of a slab links the slabs together. The last copy to go frees everything. */
+
+template <std::size_t SlabBytes>
+class node_pool_state {
+
+public:
+	struct pool {
+		pool*			next;
+		std::size_t		slot_bytes;
+		std::size_t		used;
+		void*			slabs;
+		void*			free;
+		char*			cursor;
+		char*			end;
+	};
+
+	node_pool_state();
+	~node_pool_state();
+
+	pool*			find(std::size_t slot_bytes);
+	void*			allocate(pool* from);
+	void			deallocate(pool* to, void* object);
+	void			release(pool* from);
+
+	std::size_t		refs;
+
+private:
+	node_pool_state(const node_pool_state& other);
+	node_pool_state&	operator = (const node_pool_state& other);
+
+	pool*			_pools;
+};
+
+template <std::size_t SlabBytes>
+node_pool_state<SlabBytes>::node_pool_state() : refs(1), _pools(nullptr) { }
+
+template <std::size_t SlabBytes>
+node_pool_state<SlabBytes>::~node_pool_state() {
+	pool*	next = nullptr;
+
+	for (; _pools; _pools = next) {
+		next = _pools->next;
+		_pools->used = 0;
+		release(_pools);
+		delete _pools;
+	}
+}
+
+template <std::size_t SlabBytes>
+typename node_pool_state<SlabBytes>::pool* node_pool_state<SlabBytes>::find(std::size_t slot_bytes) {
+	pool*	result = _pools;
+
+	while (result && result->slot_bytes != slot_bytes)
+		result = result->next;
+	if (result)
+		return result;
+	result = new pool();
+	result->next = _pools;
+	result->slot_bytes = slot_bytes;
+	_pools = result;
+	return result;
+}
+
+template <std::size_t SlabBytes>
+void* node_pool_state<SlabBytes>::allocate(pool* from) {
+	std::size_t	slots = (SlabBytes / from->slot_bytes > 2 ? SlabBytes / from->slot_bytes : 2);
+	void*		result = nullptr;
+
+	/* Recycle a freed slot first, then carve the current slab, then open a new one */
+
+	if (from->free) {
+		result = from->free;
+		from->free = *static_cast<void**>(result);
+	}
+	else {
+		if (from->cursor == from->end) {
+			result = ::operator new(slots * from->slot_bytes);
+			*static_cast<void**>(result) = from->slabs;
+			from->slabs = result;
+			from->cursor = static_cast<char*>(result) + from->slot_bytes;
+			from->end = static_cast<char*>(result) + slots * from->slot_bytes;
+		}
+		result = from->cursor;
+		from->cursor += from->slot_bytes;
+	}
+	++from->used;
+	return result;
+}
+
+template <std::size_t SlabBytes>
+void node_pool_state<SlabBytes>::deallocate(pool* to, void* object) {
+	*static_cast<void**>(object) = to->free;
+	to->free = object;
+	--to->used;
+}
+
+/* The slabs go back only once no copy holds an object carved out of them */
+
+template <std::size_t SlabBytes>
+void node_pool_state<SlabBytes>::release(pool* from) {
+	void*	next = nullptr;
+
+	if (from->used)
+		return ;
+	for (; from->slabs; from->slabs = next) {
+		next = *static_cast<void**>(from->slabs);
+		::operator delete(from->slabs);
+	}
+	from->free = nullptr;
+	from->cursor = nullptr;
+	from->end = nullptr;
+}
+
+/* Allocator for node based containers: single objects come from a node_pool_state, anything bigger goes to
+   operator new. Copies, rebound ones included, share the pools and compare equal ==> a node allocated through
+   one of them may be freed through any other. */
+
+template <typename T, std::size_t SlabBytes = 4096>
+class node_pool_allocator {
+
+public:
+	typedef T					value_type;
+	typedef T*					pointer;
+	typedef const T*			const_pointer;
+	typedef T&					reference;
+	typedef const T&			const_reference;
+	typedef std::size_t			size_type;
+	typedef std::ptrdiff_t		difference_type;
+
+	template <typename U>
+	struct rebind { typedef node_pool_allocator<U, SlabBytes> other; };
+
+	node_pool_allocator();
+	node_pool_allocator(const node_pool_allocator& other);
+	template <typename U>
+	node_pool_allocator(const node_pool_allocator<U, SlabBytes>& other);
+	~node_pool_allocator();
+
+	node_pool_allocator&	operator = (const node_pool_allocator& other);
+
+	pointer					address(reference x) const;
+	const_pointer			address(const_reference x) const;
+	pointer					allocate(size_type n, const void* hint = 0);
+	void					deallocate(pointer p, size_type n);
+	size_type				max_size(void) const;
+# if __cplusplus >= 201103L
+	template <typename U, typename... Args>
+	void					construct(U* p, Args&&... args);
+	template <typename U>
+	void					destroy(U* p);
+# else
+	void					construct(pointer p, const_reference val);
+	void					destroy(pointer p);
+# endif
+
+	void					release(void);
+
+	template <typename U, std::size_t>
+	friend class node_pool_allocator;
+	template <typename T1, typename T2, std::size_t Bytes>
+	friend bool operator == (const node_pool_allocator<T1, Bytes>& lhs, const node_pool_allocator<T2, Bytes>& rhs);
+
+private:
+	typedef node_pool_state<SlabBytes>				state_type;
+	typedef typename state_type::pool				pool_type;
+
+	/* A slot holds either an object || the next free slot */
+
+	union slot {
+		char		bytes[sizeof (T)];
+		void*		next;
+		long double	align_float;
+		long long	align_int;
+	};
+
+	pool_type*				pool(void);
+	void					leave(void);
+
+	state_type*	_state;
+	pool_type*	_pool;
+};
+
+template <typename T, std::size_t SlabBytes>
+node_pool_allocator<T, SlabBytes>::node_pool_allocator() : _state(new state_type()), _pool(nullptr) { }
+
+template <typename T, std::size_t SlabBytes>
+node_pool_allocator<T, SlabBytes>::node_pool_allocator(const node_pool_allocator& other) : _state(other._state), _pool(other._pool) {
+	++_state->refs;
+}
+
+template <typename T, std::size_t SlabBytes>
+template <typename U>
+node_pool_allocator<T, SlabBytes>::node_pool_allocator(const node_pool_allocator<U, SlabBytes>& other) : _state(other._state), _pool(nullptr) {
+	++_state->refs;
+}
+
+template <typename T, std::size_t SlabBytes>
+node_pool_allocator<T, SlabBytes>::~node_pool_allocator() {
+	leave();
+}
+
+template <typename T, std::size_t SlabBytes>
+node_pool_allocator<T, SlabBytes>& node_pool_allocator<T, SlabBytes>::operator = (const node_pool_allocator& other) {
+	if (_state == other._state)
+		return *this;
+	++other._state->refs;
+	leave();
+	_state = other._state;
+	_pool = other._pool;
+	return *this;
+}
+
+template <typename T, std::size_t SlabBytes>
+typename node_pool_allocator<T, SlabBytes>::pointer node_pool_allocator<T, SlabBytes>::address(reference x) const {
+	return &x;
+}
+
+template <typename T, std::size_t SlabBytes>
+typename node_pool_allocator<T, SlabBytes>::const_pointer node_pool_allocator<T, SlabBytes>::address(const_reference x) const {
+	return &x;
+}
+
+template <typename T, std::size_t SlabBytes>
+typename node_pool_allocator<T, SlabBytes>::pointer node_pool_allocator<T, SlabBytes>::allocate(size_type n, const void* hint) {
+	(void)hint;
+	if (n != 1)
+		return static_cast<pointer>(::operator new(n * sizeof (T)));
+	return static_cast<pointer>(_state->allocate(pool()));
+}
+
+template <typename T, std::size_t SlabBytes>
+void node_pool_allocator<T, SlabBytes>::deallocate(pointer p, size_type n) {
+	if (n != 1)
+		return ::operator delete(p);
+	_state->deallocate(pool(), p);
+}
+
+template <typename T, std::size_t SlabBytes>
+typename node_pool_allocator<T, SlabBytes>::size_type node_pool_allocator<T, SlabBytes>::max_size(void) const {
+	return size_type(-1) / sizeof (T);
+}
+
+# if __cplusplus >= 201103L
+
+template <typename T, std::size_t SlabBytes>
+template <typename U, typename... Args>
+void node_pool_allocator<T, SlabBytes>::construct(U* p, Args&&... args) {
+	new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+}
+
+template <typename T, std::size_t SlabBytes>
+template <typename U>
+void node_pool_allocator<T, SlabBytes>::destroy(U* p) {
+	p->~U();
+}
+
+# else
+
+template <typename T, std::size_t SlabBytes>
+void node_pool_allocator<T, SlabBytes>::construct(pointer p, const_reference val) {
+	new (static_cast<void*>(p)) T(val);
+}
+
+template <typename T, std::size_t SlabBytes>
+void node_pool_allocator<T, SlabBytes>::destroy(pointer p) {
+	p->~T();
+}
+
+# endif
+
+/* Hands the slabs back once none of the copies holds an object of this size */
+
+template <typename T, std::size_t SlabBytes>
+void node_pool_allocator<T, SlabBytes>::release(void) {
+	_state->release(pool());
+}
+
+/* The pool for objects of T, looked up the first time it is needed */
+
+template <typename T, std::size_t SlabBytes>
+typename node_pool_allocator<T, SlabBytes>::pool_type* node_pool_allocator<T, SlabBytes>::pool(void) {
+	if (!_pool)
+		_pool = _state->find(sizeof (slot));
+	return _pool;
+}
+
+template <typename T, std::size_t SlabBytes>
+void node_pool_allocator<T, SlabBytes>::leave(void) {
+	if (--_state->refs == 0)
+		delete _state;
+}
+
+template <typename T1, typename T2, std::size_t SlabBytes>
+bool operator == (const node_pool_allocator<T1, SlabBytes>& lhs, const node_pool_allocator<T2, SlabBytes>& rhs) {
+	return lhs._state == rhs._state;
+}
+
+template <typename T1, typename T2, std::size_t SlabBytes>
+bool operator != (const node_pool_allocator<T1, SlabBytes>& lhs, const node_pool_allocator<T2, SlabBytes>& rhs) {
+	return !(lhs == rhs);
+}
+
+/* Hands a container's storage back once it holds no element: a no-op unless the allocator is a node pool */
+
+template <typename Allocator>
+void release_storage(Allocator& alloc) {
+	(void)alloc;
+}
+
+template <typename T, std::size_t SlabBytes>
+void release_storage(node_pool_allocator<T, SlabBytes>& alloc) {
+	alloc.release();
+}
+
+/* The allocator a container's copy starts with: the same one, unless it is a node pool ==> the copy gets a pool
+   of its own, the two containers share no state */
+
+template <typename Allocator>
+Allocator select_on_container_copy_construction(const Allocator& alloc) {
+	return alloc;
+}
+
+template <typename T, std::size_t SlabBytes>
+node_pool_allocator<T, SlabBytes> select_on_container_copy_construction(const node_pool_allocator<T, SlabBytes>& alloc) {
+	(void)alloc;
+	return node_pool_allocator<T, SlabBytes>();
+}
+
+
+} /* FT NAMESPACE */
+
+#endif /* NODE_POOL_ALLOCATOR_H */
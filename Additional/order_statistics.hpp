@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   order_statistics.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:35:08 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 21:35:08 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ORDER_STATISTICS_H
+# define ORDER_STATISTICS_H
+
+# include <cstddef>
+# include "integral_constant.hpp"
+
+namespace ft
+{
+
+
+/* Node policies for red_black_tree. A policy adds its node_data to every node, and the tree calls its hooks
+   whenever the shape of the tree changes. */
+
+class no_order_statistics {
+
+public:
+	class node_data { };
+
+	typedef ft::false_type	counts_nodes;
+
+	template <typename Link>
+	static void			update(Link node) { (void)node; }
+	template <typename Link>
+	static void			after_insert(Link parent) { (void)parent; }
+	template <typename Link>
+	static void			before_erase(Link node) { (void)node; }
+	template <typename Link>
+	static void			swap_data(Link lhs, Link rhs) { (void)lhs; (void)rhs; }
+	template <typename Link>
+	static void			copy_data(Link dest, Link src) { (void)dest; (void)src; }
+};
+
+/* Every node counts the nodes of its subtree ==> position lookups in O(log n) */
+
+class order_statistics {
+
+public:
+	class node_data {
+
+	public:
+		node_data() : count(1) { }
+
+		std::size_t	count;
+	};
+
+	typedef ft::true_type	counts_nodes;
+
+	template <typename Link>
+	static std::size_t	count(Link node) { return (node ? node->count : 0); }
+
+	/* Recompute node's count from its children */
+
+	template <typename Link>
+	static void			update(Link node) { node->count = 1 + count(node->left) + count(node->right); }
+
+	/* A leaf was just linked under parent: every ancestor gains one node */
+
+	template <typename Link>
+	static void			after_insert(Link parent) {
+		for (; parent; parent = parent->parent)
+			++parent->count;
+	}
+
+	/* node is about to leave the tree: it no longer counts, neither for its ancestors nor for rotations */
+
+	template <typename Link>
+	static void			before_erase(Link node) {
+		node->count = 0;
+		for (node = node->parent; node; node = node->parent)
+			--node->count;
+	}
+
+	template <typename Link>
+	static void			swap_data(Link lhs, Link rhs) {
+		std::size_t	tmp = lhs->count;
+
+		lhs->count = rhs->count;
+		rhs->count = tmp;
+	}
+
+	template <typename Link>
+	static void			copy_data(Link dest, Link src) { dest->count = src->count; }
+
+	/* Position of node in the sequence, || the size of the tree for its end node */
+
+	template <typename Link>
+	static std::size_t	index(Link node, Link null) {
+		std::size_t	result = 0;
+
+		if (node == null) {
+			if (null->left == null)
+				return 0;
+			for (node = null->left; node->parent; node = node->parent) ;
+			return node->count;
+		}
+		result = count(node->left);
+		for (; node->parent; node = node->parent)
+			if (node->parent->right == node)
+				result += count(node->parent->left) + 1;
+		return result;
+	}
+};
+
+
+} /* FT NAMESPACE */
+
+#endif /* ORDER_STATISTICS_H */
@@ -13,6 +13,10 @@
 #ifndef PAIR_H
 # define PAIR_H
 
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
 namespace ft
 {
 
@@ -26,6 +30,10 @@ public:
 
 	pair();
 	pair(const first_type& _first, const second_type& _second);
+# if __cplusplus >= 201103L
+	template <typename U1, typename U2>
+	pair(U1&& _first, U2&& _second);
+# endif
 	template <typename U1, typename U2>
 	pair(const pair<U1, U2>& other);
 	~pair();
@@ -45,6 +53,14 @@ pair<T1, T2>::pair() : first(first_type()), second(second_type()) { }
 template <typename T1, typename T2>
 pair<T1, T2>::pair(const first_type& _first, const second_type& _second) : first(_first), second(_second) { }
 
+# if __cplusplus >= 201103L
+
+template <typename T1, typename T2>
+template <typename U1, typename U2>
+pair<T1, T2>::pair(U1&& _first, U2&& _second) : first(std::forward<U1>(_first)), second(std::forward<U2>(_second)) { }
+
+# endif
+
 template <typename T1, typename T2>
 template <typename U1, typename U2>
 pair<T1, T2>::pair(const pair<U1, U2>& other) : first(other.first), second(other.second) { }
@@ -14,18 +14,25 @@
 # define RED_BLACK_TREE_H
 
 # include <memory>
+# include <iterator>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 # include "less.hpp"
 # include "pair.hpp"
 # include "make_pair.hpp"
 # include "reverse_iterator.hpp"
 # include "red_black_tree_node.hpp"
 # include "red_black_tree_iterator.hpp"
+# include "node_pool_allocator.hpp"
 
 namespace ft
 {
 
 
-template <typename T, typename Compare, typename Allocator = std::allocator<ft::node<T> > >
+/* KeyOfValue extracts the key from a value, Compare orders the keys, Policy augments the nodes */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator = std::allocator<ft::node<T> >, typename Policy = ft::no_order_statistics>
 class red_black_tree {
 
 public:
@@ -34,12 +41,15 @@ public:
 	typedef	const T*													const_pointer;
 	typedef	T&															reference;
 	typedef	const T&													const_reference;
-	typedef ft::node<value_type>										node_type;
-	typedef ft::node<value_type>*										link_type;
+	typedef ft::node<value_type, Policy>								node_type;
+	typedef ft::node<value_type, Policy>*								link_type;
+	typedef Policy														policy_type;
 	typedef ft::red_black_tree_iterator<value_type, node_type>			iterator;
 	typedef ft::const_red_black_tree_iterator<value_type, node_type>	const_iterator;
 	typedef ft::reverse_iterator<iterator>								reverse_iterator;
 	typedef ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+	typedef	KeyOfValue													key_of_value;
+	typedef	typename KeyOfValue::result_type							key_type;
 	typedef	Compare														compare_type;
 	typedef	typename Allocator::template rebind<node_type>::other		allocator_type;
 	typedef	std::ptrdiff_t												difference_type;
@@ -60,32 +70,112 @@ public:
 	const_reverse_iterator				rbegin() const;
 	const_reverse_iterator				rend() const;
 
-	ft::pair<iterator, bool>			insert(link_type new_node, const value_type& value);
+	ft::pair<iterator, bool>			insert(link_type hint, const value_type& value);
+	template <typename InputIterator>
+	void								insert_range(InputIterator first, InputIterator last);
+	template <typename InputIterator>
+	void								insert_sorted(InputIterator first, InputIterator last);
+	iterator							insert_equal(link_type hint, const value_type& value);
+	template <typename InputIterator>
+	void								insert_equal_range(InputIterator first, InputIterator last);
+	template <typename Key>
+	link_type							find_position(const Key& key, link_type& parent, bool& left) const;
+# if __cplusplus >= 201103L
+	template <typename... Args>
+	iterator							insert_at(link_type parent, bool left, Args&&... args);
+# else
+	iterator							insert_at(link_type parent, bool left, const value_type& value);
+	template <typename U1, typename U2>
+	iterator							insert_at(link_type parent, bool left, const U1& first, const U2& second);
+# endif
 	void								erase(iterator node);
+	link_type							extract(iterator node);
+	ft::pair<iterator, bool>			insert_node(link_type node);
 
 	void								clear(void);
 
 	size_type							size(void) const;
 
-	iterator							find(const value_type& value);
-	const_iterator						find(const value_type& value) const;
-	iterator							lower_bound(const value_type& key);
-	const_iterator						lower_bound(const value_type& key) const;
-	iterator							upper_bound(const value_type& key);
-	const_iterator						upper_bound(const value_type& key) const;
+	template <typename Key>
+	iterator							find(const Key& key);
+	template <typename Key>
+	const_iterator						find(const Key& key) const;
+	template <typename Key>
+	iterator							lower_bound(const Key& key);
+	template <typename Key>
+	const_iterator						lower_bound(const Key& key) const;
+	template <typename Key>
+	iterator							upper_bound(const Key& key);
+	template <typename Key>
+	const_iterator						upper_bound(const Key& key) const;
+	template <typename Key>
+	ft::pair<iterator, iterator>		equal_range(const Key& key);
+	template <typename Key>
+	ft::pair<const_iterator, const_iterator>	equal_range(const Key& key) const;
+	template <typename Key>
+	ft::pair<iterator, iterator>		equal_range_unique(const Key& key);
+	template <typename Key>
+	ft::pair<const_iterator, const_iterator>	equal_range_unique(const Key& key) const;
+
+	/* O(log n) with the order_statistics policy, a walk from the nearest end without it */
+
+	iterator							select(size_type index);
+	const_iterator						select(size_type index) const;
+	template <typename Key>
+	size_type							rank(const Key& key) const;
+
+	/* Whole ranges change trees in O(log n): the nodes are relinked ==> both allocators must compare equal */
+
+	template <typename Key>
+	void								split(const Key& key, red_black_tree& greater);
+	bool								join(red_black_tree& other);
 
 	link_type		_null;
 	link_type		_root;
 	size_type		_size;
 	compare_type	_compare;
 	allocator_type	_alloc;
+	node_type		_header;
 
 private:
 
-	void								recursive_copy(link_type* dest, link_type src, link_type _null, link_type parent);
-
-	void								balance_and_delete(link_type new_node, link_type replacing_node);
+	link_type							copy_tree(link_type src, link_type& reuse);
+	link_type							clone_node(link_type src, link_type& reuse);
+	link_type							detach_nodes(void);
+	link_type							extract_node(link_type& reuse);
+
+	static const key_type&				key_of(const value_type& value);
+
+	ft::pair<iterator, bool>			insert_unique(const value_type& value);
+	iterator							attach_node(link_type parent, bool left, link_type new_node);
+
+	template <typename Key>
+	link_type							lower_bound_node(link_type node, link_type bound, const Key& key) const;
+	template <typename Key>
+	link_type							upper_bound_node(link_type node, link_type bound, const Key& key) const;
+
+	template <typename InputIterator>
+	void								__insert_range(InputIterator first, InputIterator last, bool sorted, bool unique, std::input_iterator_tag);
+	template <typename ForwardIterator>
+	void								__insert_range(ForwardIterator first, ForwardIterator last, bool sorted, bool unique, std::forward_iterator_tag);
+	template <typename ForwardIterator>
+	link_type							build_sorted(ForwardIterator& first, size_type count, size_type depth, size_type red_depth);
+	link_type							link_sorted(link_type& chain, size_type count, size_type depth, size_type red_depth);
+
+	void								unlink_node(link_type node);
+	link_type							join_nodes(link_type left, link_type pivot, link_type right);
+	template <typename Key>
+	void								split_nodes(link_type node, const Key& key, link_type& less, link_type& greater);
+	size_type							black_height(link_type node) const;
+	template <typename Key>
+	size_type							__count_less(const Key& key, ft::true_type) const;
+	template <typename Key>
+	size_type							__count_less(const Key& key, ft::false_type) const;
+	link_type							__select(size_type index, ft::true_type) const;
+	link_type							__select(size_type index, ft::false_type) const;
+	void								balance_and_unlink(link_type new_node, link_type replacing_node);
 	void								replace_node(link_type old_node, link_type new_node);
+	void								swap_with_successor(link_type node, link_type successor);
 	void								balance_after_insertion(link_type new_node);
 	void								right_rotate(link_type node);
 	void								left_rotate(link_type node);
@@ -95,335 +185,1021 @@ private:
 
 	link_type							minimum(link_type node = nullptr) const;
 	link_type							maximum(link_type node = nullptr) const;
-	void								unlink_borders(void);
-	void								link_borders(void);
+	void								reset_borders(void);
 };
 
 
-template <typename T, typename Compare, typename Allocator>
-red_black_tree<T, Compare, Allocator>::red_black_tree(const compare_type& compare, const allocator_type& alloc) :  _null(nullptr), _root(nullptr), _size(0), _compare(compare), _alloc(alloc) {
-	_null = _alloc.allocate(1);
-	_alloc.construct(_null, value_type());
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::red_black_tree(const compare_type& compare, const allocator_type& alloc) :  _null(&_header), _root(nullptr), _size(0), _compare(compare), _alloc(alloc), _header() {
 	_null->left = _null;
 	_null->right = _null;
 }
 
-template <typename T, typename Compare, typename Allocator>
-red_black_tree<T, Compare, Allocator>::red_black_tree(const red_black_tree& other) : _null(nullptr), _root(nullptr), _size(other._size), _compare(other._compare), _alloc(other._alloc) {
-	_null = _alloc.allocate(1);
-	_alloc.construct(_null, value_type());
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::red_black_tree(const red_black_tree& other) : _null(&_header), _root(nullptr), _size(other._size), _compare(other._compare), _alloc(ft::select_on_container_copy_construction(other._alloc)), _header() {
+	link_type	reuse = nullptr;
+
 	_null->left = _null;
 	_null->right = _null;
-	recursive_copy(&_root, other._root, other._null, nullptr);
-	link_borders();
+	_root = copy_tree(other._root, reuse);
+	reset_borders();
 }
 
-template <typename T, typename Compare, typename Allocator>
-red_black_tree<T, Compare, Allocator>::~red_black_tree() {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::~red_black_tree() {
 	clear();
-	delete_node(_null);
 }
 
-template <typename T, typename Compare, typename Allocator>
-red_black_tree<T, Compare, Allocator>& red_black_tree<T, Compare, Allocator>::operator = (const red_black_tree& other) {	
-	clear();
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>& red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::operator = (const red_black_tree& other) {
+	link_type	reuse = nullptr;
+
+	if (this == &other)
+		return *this;
+
+	/* Keep the current nodes aside and build the copy out of them, only the missing ones are allocated.
+	   The allocator stays, it owns the nodes being reused */
+
+	reuse = detach_nodes();
+	_compare = other._compare;
+	_root = copy_tree(other._root, reuse);
 	_size = other._size;
-	_alloc = other._alloc;
-	recursive_copy(&_root, other._root, other._null, nullptr);
-	link_borders();
+	reset_borders();
+	while (reuse)
+		delete_node(extract_node(reuse));
 	return *this;
 }
 
 /* ITERATORS START --> */
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::begin() {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::begin() {
 	return iterator(_null->left, _null);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::end() {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::end() {
 	return iterator(_null, _null);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::begin() const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::begin() const {
 	return const_iterator(_null->left, _null);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::end() const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::end() const {
 	return const_iterator(_null, _null);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::reverse_iterator red_black_tree<T, Compare, Allocator>::rbegin() {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::reverse_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::rbegin() {
 	return reverse_iterator(end());
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::reverse_iterator red_black_tree<T, Compare, Allocator>::rend() {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::reverse_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::rend() {
 	return reverse_iterator(begin());
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::const_reverse_iterator red_black_tree<T, Compare, Allocator>::rbegin() const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_reverse_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::rbegin() const {
 	return const_reverse_iterator(end());
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::const_reverse_iterator red_black_tree<T, Compare, Allocator>::rend() const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_reverse_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::rend() const {
 	return const_reverse_iterator(begin());
 }
 
 /* <-- ITERATORS END */
 
-template <typename T, typename Compare, typename Allocator>
-ft::pair<typename red_black_tree<T, Compare, Allocator>::iterator, bool> red_black_tree<T, Compare, Allocator>::insert(link_type new_node, const value_type& value) {
-	link_type	parent = nullptr;
-	new_node = _root;
-
-	/* Find position for new_node */
-
-	unlink_borders();
-	while (new_node) {
-		parent = new_node;
-		if (_compare(value, new_node->value))
-			new_node = new_node->left;
-		else if (_compare(new_node->value, value))
-			new_node = new_node->right;
-		else if (!_compare(value, new_node->value) && !_compare(new_node->value, value)) {
-			link_borders();
-			return ft::make_pair(iterator(new_node, _null), false);
-		}
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator, bool> red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert(link_type hint, const value_type& value) {
+	link_type	neighbour = nullptr;
+
+	/* No usable hint ==> search from the root */
+
+	if (!hint || !_root)
+		return insert_unique(value);
+
+	/* The hint is end() ==> the value goes after the rightmost node if it is greater */
+
+	if (hint == _null) {
+		if (_compare(key_of(_null->right->value), key_of(value)))
+			return ft::make_pair(insert_at(_null->right, false, value), true);
+		return insert_unique(value);
 	}
 
-	/* Create new_node if the same value doesn't exist */
+	/* The value belongs right before the hint ==> it must also be greater than the hint's predecessor */
+
+	if (_compare(key_of(value), key_of(hint->value))) {
+		if (hint == _null->left)
+			return ft::make_pair(insert_at(hint, true, value), true);
+		neighbour = (--iterator(hint, _null))._base;
+		if (!_compare(key_of(neighbour->value), key_of(value)))
+			return insert_unique(value);
+		if (!neighbour->right)
+			return ft::make_pair(insert_at(neighbour, false, value), true);
+		return ft::make_pair(insert_at(hint, true, value), true);
+	}
 
-	new_node = _alloc.allocate(1);
-	_alloc.construct(new_node, value);
+	/* The value belongs right after the hint ==> it must also be less than the hint's successor */
+
+	if (_compare(key_of(hint->value), key_of(value))) {
+		if (hint == _null->right)
+			return ft::make_pair(insert_at(hint, false, value), true);
+		neighbour = (++iterator(hint, _null))._base;
+		if (!_compare(key_of(value), key_of(neighbour->value)))
+			return insert_unique(value);
+		if (!hint->right)
+			return ft::make_pair(insert_at(hint, false, value), true);
+		return ft::make_pair(insert_at(neighbour, true, value), true);
+	}
+	return ft::make_pair(iterator(hint, _null), false);
+}
 
-	/* Assign new_node to its parent || root */
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename InputIterator>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_range(InputIterator first, InputIterator last) {
+	typedef typename ft::iterator_traits<InputIterator>::iterator_category	_Category;
+	__insert_range(first, last, false, true, _Category());
+}
 
-	if (!_root)
-		_root = new_node;
-	else if (_compare(value, parent->value))
-		parent->left = new_node;
-	else if (_compare(parent->value, value))
-		parent->right = new_node;
-	new_node->parent = parent;
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename InputIterator>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_sorted(InputIterator first, InputIterator last) {
+	typedef typename ft::iterator_traits<InputIterator>::iterator_category	_Category;
+	__insert_range(first, last, true, true, _Category());
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_equal(link_type hint, const value_type& value) {
+	link_type	neighbour = nullptr;
+	link_type	parent = nullptr;
+	bool		left = true;
+	bool		after = true;
 
-	/* Rebalance the tree */
+	/* A usable hint ==> the value goes as close as possible to it: right before it if it is not greater than the hint
+	   nor less than its predecessor, else right after it if it is not less than the hint nor greater than its successor */
 
-	++_size;
-	balance_after_insertion(new_node);
-	link_borders();
-	return ft::make_pair(iterator(new_node, _null), true);
+	if (hint && _root) {
+		if (hint == _null) {
+			if (!_compare(key_of(value), key_of(_null->right->value)))
+				return insert_at(_null->right, false, value);
+		}
+		else if (!_compare(key_of(hint->value), key_of(value))) {
+			if (hint == _null->left)
+				return insert_at(hint, true, value);
+			neighbour = (--iterator(hint, _null))._base;
+			if (!_compare(key_of(value), key_of(neighbour->value))) {
+				if (!neighbour->right)
+					return insert_at(neighbour, false, value);
+				return insert_at(hint, true, value);
+			}
+		}
+		else {
+			if (hint == _null->right)
+				return insert_at(hint, false, value);
+			neighbour = (++iterator(hint, _null))._base;
+			if (!_compare(key_of(neighbour->value), key_of(value))) {
+				if (!hint->right)
+					return insert_at(hint, false, value);
+				return insert_at(neighbour, true, value);
+			}
+			after = false;
+		}
+	}
+
+	/* Else descend from the root: the value goes after its equals, || before them when it was hinted from below */
+
+	for (link_type curr = _root; curr; curr = left ? curr->left : curr->right) {
+		parent = curr;
+		left = (after ? _compare(key_of(value), key_of(curr->value)) : !_compare(key_of(curr->value), key_of(value)));
+	}
+	return insert_at(parent, left, value);
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::erase(iterator iter) {
-	link_type	replacing_node = nullptr;
-	link_type	buffer_node = nullptr;
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename InputIterator>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_equal_range(InputIterator first, InputIterator last) {
+	typedef typename ft::iterator_traits<InputIterator>::iterator_category	_Category;
+	__insert_range(first, last, false, false, _Category());
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::erase(iterator iter) {
 	link_type	node = iter._base;
 
 	/* Check if a node exists */
 
 	if (!node || node == _null)
 		return ;
+	unlink_node(node);
+	delete_node(node);
+}
 
-	unlink_borders();
-
-	/* Firtsly: perform BST deletion */
-
-	while (true) {
-
-		/* If node is a leaf node ==> replace it with null after balancing */
+/* Unlinks node for a node handle, which frees it with a copy of this tree's allocator */
 
-		if (!node->left && !node->right) {
-			replacing_node = nullptr;
-			break ;
-		}
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::extract(iterator iter) {
+	link_type	node = iter._base;
 
-		/* Else if node has only one child ==> replace the node with its child */
+	if (!node || node == _null)
+		return nullptr;
+	unlink_node(node);
+	node->parent = nullptr;
+	node->left = nullptr;
+	node->right = nullptr;
+	node->color = red;
+	Policy::update(node);
+	return node;
+}
 
-		else if (!node->left) {
-			replacing_node = node->right;
-			break ;
-		}
-		else if (!node->right) {
-			replacing_node = node->left;
-			break ;
-		}
+/* Links an extracted node in unless its key is already there. Its allocator must compare equal to this tree's */
 
-		/* Else: node has both children ==> replace it with node's inorder successor */
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator, bool> red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_node(link_type node) {
+	link_type	parent = nullptr;
+	link_type	found = nullptr;
+	bool		left = true;
 
-		else {
-			replacing_node = minimum(node->right);
+	found = find_position(key_of(node->value), parent, left);
+	if (found)
+		return ft::make_pair(iterator(found, _null), false);
+	return ft::make_pair(attach_node(parent, left, node), true);
+}
 
-			/* Create a buffer node so as to store inorder successor's value */
+/* Takes node out of the tree without freeing it */
 
-			buffer_node = _alloc.allocate(1);
-			_alloc.construct(buffer_node, *replacing_node);
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::unlink_node(link_type node) {
+	link_type	replacing_node = nullptr;
 
-			/* Copy node's links and color to buffer node */
+	/* Firstly: perform BST deletion, a node with both children trades places with its inorder successor */
 
-			*buffer_node = *node;
+	if (node->left && node->right)
+		swap_with_successor(node, minimum(node->right));
 
-			/* Replace node's parent's and children's links so that they point to buffer node */
-	
-			replace_node(node, buffer_node);
-			if (buffer_node->left)
-				buffer_node->left->parent = buffer_node;
-			if (buffer_node->right)
-				buffer_node->right->parent = buffer_node;
+	/* node is a leaf ==> replace it with null after balancing, else replace it with its only child */
 
-			/* Delete previous node with old value that was replaced */
+	replacing_node = node->left ? node->left : node->right;
+	Policy::before_erase(node);
 
-			delete_node(node);
-			node = replacing_node;
+	/* node has at most one child here ==> its in-order neighbour on the childless side is its parent */
 
-			/* Assign replacing node to node so as to check if it has children for the deletion in the next iteration */
-		}
+	if (node == _null->left)
+		_null->left = node->right ? node->right : node->parent;
+	if (node == _null->right)
+		_null->right = node->left ? node->left : node->parent;
+	if (!_null->left || !_null->right) {
+		_null->left = _null;
+		_null->right = _null;
 	}
-	balance_and_delete(node, replacing_node);
-	link_borders();
+	balance_and_unlink(node, replacing_node);
 	--_size;
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::clear(void) {
-	unlink_borders();
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::clear(void) {
 	clear_tree(_root);
 	_root = nullptr;
 	_size = 0;
+	reset_borders();
+	ft::release_storage(_alloc);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::size_type red_black_tree<T, Compare, Allocator>::size(void) const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::size_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::size(void) const {
 	return _size;
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::find(const value_type& value) {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::find(const Key& key) {
+	link_type	node = lower_bound_node(_root, _null, key);
+
+	/* The first node not less than key holds it, unless key is less than that node */
+
+	if (node == _null || _compare(key, key_of(node->value)))
+		return iterator(_null, _null);
+	return iterator(node, _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::find(const Key& key) const {
+	link_type	node = lower_bound_node(_root, _null, key);
+
+	/* The first node not less than key holds it, unless key is less than that node */
+
+	if (node == _null || _compare(key, key_of(node->value)))
+		return const_iterator(_null, _null);
+	return const_iterator(node, _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::lower_bound(const Key& key) {
+	return iterator(lower_bound_node(_root, _null, key), _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::lower_bound(const Key& key) const {
+	return const_iterator(lower_bound_node(_root, _null, key), _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::upper_bound(const Key& key) {
+	return iterator(upper_bound_node(_root, _null, key), _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::upper_bound(const Key& key) const {
+	return const_iterator(upper_bound_node(_root, _null, key), _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+ft::pair<typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator, typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator> red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::equal_range(const Key& key) {
 	link_type	curr = _root;
-	
-	while (curr && curr != _null) {
-		if (_compare(value, curr->value))
-			curr = curr->left;
-		else if (_compare(curr->value, value))
+	link_type	bound = _null;
+
+	/* Descend together until a node holds key, then the lower bound is in its left subtree and the upper one in its right */
+
+	while (curr) {
+		if (_compare(key_of(curr->value), key))
 			curr = curr->right;
-		else if (!_compare(curr->value, value) && !_compare(value, curr->value))
-			return iterator(curr, _null);
+		else if (_compare(key, key_of(curr->value))) {
+			bound = curr;
+			curr = curr->left;
+		}
+		else
+			return ft::make_pair(iterator(lower_bound_node(curr->left, curr, key), _null), iterator(upper_bound_node(curr->right, bound, key), _null));
 	}
-	return iterator(_null, _null);
+	return ft::make_pair(iterator(bound, _null), iterator(bound, _null));
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+ft::pair<typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator, typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator> red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::equal_range(const Key& key) const {
+	ft::pair<iterator, iterator>	range = const_cast<red_black_tree*>(this)->equal_range(key);
+
+	return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+ft::pair<typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator, typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator> red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::equal_range_unique(const Key& key) {
+	link_type	node = lower_bound_node(_root, _null, key);
+	iterator	last(node, _null);
+
+	/* Keys are unique ==> the range is the lower bound alone, || empty */
+
+	if (node != _null && !_compare(key, key_of(node->value)))
+		++last;
+	return ft::make_pair(iterator(node, _null), last);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+ft::pair<typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator, typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator> red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::equal_range_unique(const Key& key) const {
+	ft::pair<iterator, iterator>	range = const_cast<red_black_tree*>(this)->equal_range_unique(key);
+
+	return ft::make_pair(const_iterator(range.first), const_iterator(range.second));
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::select(size_type index) {
+	return iterator(__select(index, typename Policy::counts_nodes()), _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::const_iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::select(size_type index) const {
+	return const_iterator(__select(index, typename Policy::counts_nodes()), _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::size_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::rank(const Key& key) const {
+	return __count_less(key, typename Policy::counts_nodes());
+}
+
+/* Moves the elements not less than key into greater, whatever greater held is dropped. The nodes are relinked
+   when both allocators compare equal, copied otherwise */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::split(const Key& key, red_black_tree& greater) {
+	link_type	less_root = nullptr;
+	link_type	greater_root = nullptr;
+	size_type	less_count = 0;
+	iterator	first;
+
+	greater.clear();
+	if (!_root)
+		return ;
+
+	/* Nodes from another allocator can't be relinked ==> copy them over */
+
+	if (!(_alloc == greater._alloc)) {
+		first = lower_bound(key);
+		greater.insert_sorted(first, end());
+		while (first != end())
+			erase(first++);
+		return ;
+	}
+	less_count = __count_less(key, typename Policy::counts_nodes());
+	split_nodes(_root, key, less_root, greater_root);
+	greater._root = greater_root;
+	greater._size = _size - less_count;
+	greater.reset_borders();
+	_root = less_root;
+	_size = less_count;
+	reset_borders();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::find(const value_type& value) const {
+/* Moves every element of other into this tree. other's keys must all go after || all before this tree's ones,
+   else nothing is moved and false is returned. The nodes are relinked when both allocators compare equal */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+bool red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::join(red_black_tree& other) {
+	link_type	pivot = nullptr;
+	bool		after = true;
+
+	if (!other._root)
+		return true;
+	if (_root) {
+		after = _compare(key_of(_null->right->value), key_of(other._null->left->value));
+		if (!after && !_compare(key_of(other._null->right->value), key_of(_null->left->value)))
+			return false;
+	}
+	if (!(_alloc == other._alloc)) {
+		insert_range(other.begin(), other.end());
+		other.clear();
+		return true;
+	}
+
+	/* The pivot joining both trees is other's element closest to this tree */
+
+	if (_root) {
+		pivot = (after ? other._null->left : other._null->right);
+		other.unlink_node(pivot);
+		_size += 1 + other._size;
+		_root = (after ? join_nodes(_root, pivot, other._root) : join_nodes(other._root, pivot, _root));
+	}
+	else {
+		_root = other._root;
+		_size = other._size;
+	}
+	reset_borders();
+	other._root = nullptr;
+	other._size = 0;
+	other.reset_borders();
+	return true;
+}
+
+/* Links left, pivot and right into one tree, left's keys < pivot's < right's. pivot hangs off the spine of the
+   taller side at the height of the shorter one, and is then balanced like an inserted node: O(difference in height) */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::join_nodes(link_type left, link_type pivot, link_type right) {
+	link_type	parent = nullptr;
+	link_type	node = nullptr;
+	size_type	left_height = 0;
+	size_type	right_height = 0;
+	bool		left_taller = false;
+
+	/* Rotations update _root, it holds the root of the tree being joined */
+
+	if (left) {
+		left->parent = nullptr;
+		left->color = black;
+	}
+	if (right) {
+		right->parent = nullptr;
+		right->color = black;
+	}
+	left_height = black_height(left);
+	right_height = black_height(right);
+	left_taller = (left_height >= right_height);
+	pivot->color = red;
+	if (left_taller) {
+		for (node = left; node && (node->color == red || left_height > right_height); node = node->right) {
+			if (node->color == black)
+				--left_height;
+			parent = node;
+		}
+		pivot->left = node;
+		pivot->right = right;
+		if (parent)
+			parent->right = pivot;
+	}
+	else {
+		for (node = right; node && (node->color == red || right_height > left_height); node = node->left) {
+			if (node->color == black)
+				--right_height;
+			parent = node;
+		}
+		pivot->left = left;
+		pivot->right = node;
+		if (parent)
+			parent->left = pivot;
+	}
+	pivot->parent = parent;
+	if (pivot->left)
+		pivot->left->parent = pivot;
+	if (pivot->right)
+		pivot->right->parent = pivot;
+	_root = (!parent ? pivot : left_taller ? left : right);
+	for (node = pivot; node; node = node->parent)
+		Policy::update(node);
+	balance_after_insertion(pivot);
+	_root->color = black;
+	return _root;
+}
+
+/* Splits the subtree under node into the nodes less than key and the others, joining the pieces on the way back up */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::split_nodes(link_type node, const Key& key, link_type& less, link_type& greater) {
+	link_type	left = nullptr;
+	link_type	right = nullptr;
+	link_type	rest = nullptr;
+
+	if (!node) {
+		less = nullptr;
+		greater = nullptr;
+		return ;
+	}
+	left = node->left;
+	right = node->right;
+	if (_compare(key_of(node->value), key)) {
+		split_nodes(right, key, rest, greater);
+		less = join_nodes(left, node, rest);
+	}
+	else {
+		split_nodes(left, key, less, rest);
+		greater = join_nodes(rest, node, right);
+	}
+}
+
+/* Black nodes on the way down to a leaf, every path has as many */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::size_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::black_height(link_type node) const {
+	size_type	height = 0;
+
+	for (; node; node = node->left)
+		if (node->color == black)
+			++height;
+	return height;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::size_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::__count_less(const Key& key, ft::true_type) const {
 	link_type	curr = _root;
-	
-	while (curr && curr != _null) {
-		if (_compare(value, curr->value))
-			curr = curr->left;
-		else if (_compare(curr->value, value))
+	size_type	result = 0;
+
+	/* Count the keys less than key on the way down */
+
+	while (curr) {
+		if (_compare(key_of(curr->value), key)) {
+			result += Policy::count(curr->left) + 1;
 			curr = curr->right;
-		else if (!_compare(curr->value, value) && !_compare(value, curr->value))
-			return const_iterator(curr, _null);
+		}
+		else
+			curr = curr->left;
 	}
-	return const_iterator(_null, _null);
+	return result;
+}
+
+/* Without subtree counts ==> walk from both ends towards the bound, the shorter side decides */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::size_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::__count_less(const Key& key, ft::false_type) const {
+	const_iterator	bound = lower_bound(key);
+	const_iterator	front = begin();
+	const_iterator	back = end();
+	size_type		steps = 0;
+
+	while (front != bound && back != bound) {
+		++front;
+		--back;
+		++steps;
+	}
+	return (front == bound ? steps : _size - steps);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::lower_bound(const value_type& value) {
+/* The subtree counts tell which way the index-th node is */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::__select(size_type index, ft::true_type) const {
 	link_type	curr = _root;
-	
-	while (curr && curr != _null) {	
-		if (_compare(value, curr->value) && curr->left && curr->left != _null)
+
+	while (curr) {
+		if (index < Policy::count(curr->left))
 			curr = curr->left;
-		else if (_compare(curr->value, value) && curr->right && curr->right != _null)
+		else if (index == Policy::count(curr->left))
+			return curr;
+		else {
+			index -= Policy::count(curr->left) + 1;
 			curr = curr->right;
-		else if (!_compare(curr->value, value) && !_compare(value, curr->value))
-			return iterator(curr, _null);
-		else if (_compare(value, curr->value) && (!curr->left || curr->left == _null))
-			return iterator(curr, _null);
-		else if (_compare(curr->value, value) && (!curr->right || curr->right == _null))
-			return ++iterator(curr, _null);
+		}
 	}
-	return iterator(_null, _null);
+	return _null;
+}
+
+/* Without subtree counts ==> step from the closer end */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::__select(size_type index, ft::false_type) const {
+	const_iterator	curr = end();
+
+	if (index >= _size)
+		return _null;
+	if (index < _size / 2)
+		for (curr = begin(); index; --index)
+			++curr;
+	else
+		for (index = _size - index; index; --index)
+			--curr;
+	return const_cast<link_type>(curr._base);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::lower_bound_node(link_type node, link_type bound, const Key& key) const {
+
+	/* The last node not less than key on the way down from node, || bound if there is none */
+
+	while (node) {
+		if (!_compare(key_of(node->value), key)) {
+			bound = node;
+			node = node->left;
+		}
+		else
+			node = node->right;
+	}
+	return bound;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::upper_bound_node(link_type node, link_type bound, const Key& key) const {
+
+	/* The last node greater than key on the way down from node, || bound if there is none */
+
+	while (node) {
+		if (_compare(key, key_of(node->value))) {
+			bound = node;
+			node = node->left;
+		}
+		else
+			node = node->right;
+	}
+	return bound;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator, bool> red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_unique(const value_type& value) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = find_position(key_of(value), parent, left);
+
+	if (found)
+		return ft::make_pair(iterator(found, _null), false);
+	return ft::make_pair(insert_at(parent, left, value), true);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::lower_bound(const value_type& value) const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename Key>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::find_position(const Key& key, link_type& parent, bool& left) const {
 	link_type	curr = _root;
-	
-	while (curr && curr != _null) {
-		if (_compare(value, curr->value) && curr->left && curr->left != _null)
+	link_type	candidate = nullptr;
+
+	/* Return the node holding key, || nullptr and the place where a node holding it would be attached */
+
+	/* One comparison per level: the last node passed on the right is the greatest one not greater than key,
+	   it holds key unless it is less than key */
+
+	parent = nullptr;
+	left = true;
+	while (curr) {
+		parent = curr;
+		left = _compare(key, key_of(curr->value));
+		if (left)
 			curr = curr->left;
-		else if (_compare(curr->value, value) && curr->right && curr->right != _null)
+		else {
+			candidate = curr;
 			curr = curr->right;
-		else if (!_compare(curr->value, value) && !_compare(value, curr->value))
-			return const_iterator(curr, _null);
-		else if (_compare(value, curr->value) && (!curr->left || curr->left == _null))
-			return const_iterator(curr, _null);
-		else if (_compare(curr->value, value) && (!curr->right || curr->right == _null))
-			return ++const_iterator(curr, _null);
+		}
 	}
-	return const_iterator(_null, _null);
+	if (candidate && !_compare(key_of(candidate->value), key))
+		return candidate;
+	return nullptr;
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::iterator red_black_tree<T, Compare, Allocator>::upper_bound(const value_type& value) {
-	iterator it = lower_bound(value);
-	
-	if (it != end() && !_compare(value, *it) && !_compare(*it, value))
-		++it;
-	return it;	
+# if __cplusplus >= 201103L
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename... Args>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_at(link_type parent, bool left, Args&&... args) {
+	link_type	new_node = _alloc.allocate(1);
+
+	_alloc.construct(new_node, std::forward<Args>(args)...);
+	return attach_node(parent, left, new_node);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::const_iterator red_black_tree<T, Compare, Allocator>::upper_bound(const value_type& value) const {
-	const_iterator it = lower_bound(value);
-	
-	if (it != end() && !_compare(value, *it) && !_compare(*it, value))
-		++it;
-	return it;
+# else
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_at(link_type parent, bool left, const value_type& value) {
+	link_type	new_node = _alloc.allocate(1);
+
+	_alloc.construct(new_node, value);
+	return attach_node(parent, left, new_node);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename U1, typename U2>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::insert_at(link_type parent, bool left, const U1& first, const U2& second) {
+	link_type	new_node = _alloc.allocate(1);
+
+	_alloc.construct(new_node, value_type(first, second));
+	return attach_node(parent, left, new_node);
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::recursive_copy(link_type* dest, link_type src, link_type _null, link_type parent) {
-	if (!src || src == _null) {
-		*dest = nullptr;
+# endif
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::iterator red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::attach_node(link_type parent, bool left, link_type new_node) {
+	new_node->parent = parent;
+
+	/* Assign new_node to its parent || root, the header caches the leftmost and rightmost nodes */
+
+	if (!parent) {
+		_root = new_node;
+		_null->left = new_node;
+		_null->right = new_node;
+	}
+	else if (left) {
+		parent->left = new_node;
+		if (parent == _null->left)
+			_null->left = new_node;
+	}
+	else {
+		parent->right = new_node;
+		if (parent == _null->right)
+			_null->right = new_node;
+	}
+
+	/* Rebalance the tree, rotations don't change the leftmost and rightmost nodes */
+
+	++_size;
+	Policy::after_insert(parent);
+	balance_after_insertion(new_node);
+	return iterator(new_node, _null);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename InputIterator>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::__insert_range(InputIterator first, InputIterator last, bool sorted, bool unique, std::input_iterator_tag) {
+	(void)sorted;
+	for (; first != last; ++first) {
+		if (unique)
+			insert(_null, *first);
+		else
+			insert_equal(_null, *first);
+	}
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename ForwardIterator>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::__insert_range(ForwardIterator first, ForwardIterator last, bool sorted, bool unique, std::forward_iterator_tag) {
+	ForwardIterator	prev = first;
+	ForwardIterator	curr = first;
+	size_type		count = 0;
+	size_type		red_depth = 0;
+
+	/* A non-empty tree || an unsorted range ==> insert one by one, hinting at the end */
+
+	link_type		chain = nullptr;
+	link_type		tail = nullptr;
+
+	if (_root)
+		return __insert_range(first, last, sorted, unique, std::input_iterator_tag());
+
+	/* A promised order ==> the range is read once, its nodes are chained through their right links and linked up after.
+	   Otherwise unique keys must be strictly increasing, equal keys only must not decrease */
+
+	if (sorted) {
+		for (; first != last; ++first, ++count) {
+			link_type	node = _alloc.allocate(1);
+
+			_alloc.construct(node, *first);
+			if (tail)
+				tail->right = node;
+			else
+				chain = node;
+			tail = node;
+		}
+	}
+	else if (curr != last) {
+		for (++curr, ++count; curr != last; ++prev, ++curr, ++count) {
+			if (unique ? !_compare(key_of(*prev), key_of(*curr)) : _compare(key_of(*curr), key_of(*prev)))
+				return __insert_range(first, last, sorted, unique, std::input_iterator_tag());
+		}
+	}
+	if (!count)
 		return ;
+
+	/* Build a perfectly balanced tree: every level is full but the deepest one, which is colored red */
+
+	for (size_type full = count + 1; full > 1; full >>= 1)
+		++red_depth;
+	_root = (sorted ? link_sorted(chain, count, 0, red_depth) : build_sorted(first, count, 0, red_depth));
+	_root->parent = nullptr;
+	_size = count;
+	reset_borders();
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+template <typename ForwardIterator>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::build_sorted(ForwardIterator& first, size_type count, size_type depth, size_type red_depth) {
+	link_type	left = nullptr;
+	link_type	node = nullptr;
+
+	if (!count)
+		return nullptr;
+
+	/* Build the left half, take the middle element, then build the right half ==> the range is read in order */
+
+	left = build_sorted(first, count / 2, depth + 1, red_depth);
+	node = _alloc.allocate(1);
+	_alloc.construct(node, *first);
+	++first;
+	node->color = (depth == red_depth ? red : black);
+	node->left = left;
+	if (left)
+		left->parent = node;
+	node->right = build_sorted(first, count - count / 2 - 1, depth + 1, red_depth);
+	if (node->right)
+		node->right->parent = node;
+	Policy::update(node);
+	return node;
+}
+
+/* Same shape as build_sorted, the nodes are taken off the chain instead of being built */
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_sorted(link_type& chain, size_type count, size_type depth, size_type red_depth) {
+	link_type	left = nullptr;
+	link_type	node = nullptr;
+
+	if (!count)
+		return nullptr;
+	left = link_sorted(chain, count / 2, depth + 1, red_depth);
+	node = chain;
+	chain = chain->right;
+	node->color = (depth == red_depth ? red : black);
+	node->left = left;
+	if (left)
+		left->parent = node;
+	node->right = link_sorted(chain, count - count / 2 - 1, depth + 1, red_depth);
+	if (node->right)
+		node->right->parent = node;
+	Policy::update(node);
+	return node;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::copy_tree(link_type src, link_type& reuse) {
+	link_type	root = nullptr;
+	link_type	dest = nullptr;
+
+	if (!src)
+		return nullptr;
+	root = clone_node(src, reuse);
+	dest = root;
+
+	/* Walk the source in preorder through the parent links, the copy is walked in lockstep */
+
+	while (true) {
+		if (src->left && !dest->left) {
+			dest->left = clone_node(src->left, reuse);
+			dest->left->parent = dest;
+			src = src->left;
+			dest = dest->left;
+		}
+		else if (src->right && !dest->right) {
+			dest->right = clone_node(src->right, reuse);
+			dest->right->parent = dest;
+			src = src->right;
+			dest = dest->right;
+		}
+		else if (dest == root)
+			break ;
+		else {
+			src = src->parent;
+			dest = dest->parent;
+		}
+	}
+	return root;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::clone_node(link_type src, link_type& reuse) {
+	link_type	node = reuse;
+
+	/* Take a detached node if one is left, its memory is kept but its value is rebuilt */
+
+	if (node) {
+		node = extract_node(reuse);
+		_alloc.destroy(node);
+	}
+	else
+		node = _alloc.allocate(1);
+	_alloc.construct(node, src->value);
+	node->color = src->color;
+	Policy::copy_data(node, src);
+	return node;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::detach_nodes(void) {
+	link_type	first = _root ? _null->right : nullptr;
+
+	/* The tree is emptied but its nodes stay linked, they are taken leaf by leaf starting from the rightmost one */
+
+	if (first && first->left)
+		first = first->left;
+	_root = nullptr;
+	_size = 0;
+	reset_borders();
+	return first;
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::extract_node(link_type& reuse) {
+	link_type	node = reuse;
+
+	/* node is a leaf: unlink it and move reuse to the next leaf, right subtrees go before left ones */
+
+	reuse = node->parent;
+	if (!reuse)
+		return node;
+	if (reuse->right == node) {
+		reuse->right = nullptr;
+		if (reuse->left) {
+			reuse = reuse->left;
+			while (reuse->right)
+				reuse = reuse->right;
+			if (reuse->left)
+				reuse = reuse->left;
+		}
 	}
-	*dest = _alloc.allocate(1);
-	_alloc.construct(*dest, *src);
-	(*dest)->parent = parent;
-	recursive_copy(&(*dest)->left, src->left, _null, *dest);
-	recursive_copy(&(*dest)->right, src->right, _null, *dest);
+	else
+		reuse->left = nullptr;
+	return node;
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::delete_node(link_type node) {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::delete_node(link_type node) {
 	if (node) {
 		_alloc.destroy(node);
 		_alloc.deallocate(node, 1);
 	}
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::clear_tree(link_type node) {
-	if(!node)
-		return ;
-	if (node->left)
-		clear_tree(node->left);
-	if (node->right)
-		clear_tree(node->right);
-	delete_node(node);
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::clear_tree(link_type node) {
+	link_type	next = nullptr;
+
+	/* Free in order without recursion: a left child is rotated up, a node without one is freed */
+
+	while (node) {
+		if (node->left) {
+			next = node->left;
+			node->left = next->right;
+			next->right = node;
+		}
+		else {
+			next = node->right;
+			delete_node(node);
+		}
+		node = next;
+	}
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::balance_after_insertion(link_type new_node) {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::balance_after_insertion(link_type new_node) {
 	link_type	uncle = nullptr;
 	
 	while (true) {
@@ -486,8 +1262,8 @@ void red_black_tree<T, Compare, Allocator>::balance_after_insertion(link_type ne
 	}
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::balance_and_delete(link_type node, link_type replacing_node) {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::balance_and_unlink(link_type node, link_type replacing_node) {
 	link_type	sibling = nullptr;
 	link_type	red_cousin = nullptr;
 	link_type	close_cousin = nullptr;
@@ -498,7 +1274,6 @@ void red_black_tree<T, Compare, Allocator>::balance_and_delete(link_type node, l
 	// std::cout << node->value.first << std::endl;
 
 	if (node == _root && !replacing_node) {
-		delete_node(_root);
 		_root = nullptr;
 		return ;
 	}
@@ -593,18 +1368,17 @@ void red_black_tree<T, Compare, Allocator>::balance_and_delete(link_type node, l
 			}
 		}
 
-		/* Unlink and delete node after balancing */
+		/* Unlink node after balancing */
 
 		if (node->is_left_child())
 			node->parent->left = nullptr;
 		else
 			node->parent->right = nullptr;
 	}
-	delete_node(node);
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::right_rotate(link_type node) {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::right_rotate(link_type node) {
 	link_type	left_node = node->left;
 
     replace_node(node, left_node);
@@ -613,10 +1387,12 @@ void red_black_tree<T, Compare, Allocator>::right_rotate(link_type node) {
         left_node->right->parent = node;
     left_node->right = node;
     node->parent = left_node;
+    Policy::update(node);
+    Policy::update(left_node);
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::left_rotate(link_type node) {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::left_rotate(link_type node) {
 	link_type	right_node = node->right;
 
     replace_node(node, right_node);
@@ -625,10 +1401,12 @@ void red_black_tree<T, Compare, Allocator>::left_rotate(link_type node) {
         right_node->left->parent = node;
     right_node->left = node;
     node->parent = right_node;
+    Policy::update(node);
+    Policy::update(right_node);
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::replace_node(link_type old_node, link_type new_node) {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::replace_node(link_type old_node, link_type new_node) {
     if (!old_node->parent)
         _root = new_node;
     else {
@@ -641,34 +1419,52 @@ void red_black_tree<T, Compare, Allocator>::replace_node(link_type old_node, lin
         new_node->parent = old_node->parent;
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::link_borders(void) {
-	if (!_root)
-		return ;
-	
-	link_type	min = minimum();
-	link_type	max = maximum();
-
-	min->left = _null;
-	max->right = _null;
-	_null->left = min;
-	_null->right = max;
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+const typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::key_type& red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::key_of(const value_type& value) {
+	return KeyOfValue()(value);
 }
 
-template <typename T, typename Compare, typename Allocator>
-void red_black_tree<T, Compare, Allocator>::unlink_borders(void) {
-	if(_root) {
-		minimum()->left = nullptr;
-		maximum()->right = nullptr;
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::swap_with_successor(link_type node, link_type successor) {
+	link_type	successor_parent = successor->parent;
+	link_type	successor_right = successor->right;
+	node_color	color = node->color;
+
+	/* Relink the successor in node's place, the values stay in their nodes so that no iterator is invalidated */
+
+	replace_node(node, successor);
+	successor->left = node->left;
+	successor->left->parent = successor;
+	if (successor_parent == node) {
+		successor->right = node;
+		node->parent = successor;
 	}
-	else
-		_root = nullptr;
-	_null->left = _null;
-	_null->right = _null;
+	else {
+		successor->right = node->right;
+		successor->right->parent = successor;
+		successor_parent->left = node;
+		node->parent = successor_parent;
+	}
+
+	/* node takes the successor's old place: no left child, at most a right one */
+
+	node->left = nullptr;
+	node->right = successor_right;
+	if (successor_right)
+		successor_right->parent = node;
+	node->color = successor->color;
+	successor->color = color;
+	Policy::swap_data(node, successor);
+}
+
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+void red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::reset_borders(void) {
+	_null->left = _root ? minimum() : _null;
+	_null->right = _root ? maximum() : _null;
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::link_type red_black_tree<T, Compare, Allocator>::minimum(link_type node) const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::minimum(link_type node) const {
 	if (!node)
 		node = _root;
 	while (node->left && node->left != _null)
@@ -676,8 +1472,8 @@ typename red_black_tree<T, Compare, Allocator>::link_type red_black_tree<T, Comp
 	return node;
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename red_black_tree<T, Compare, Allocator>::link_type red_black_tree<T, Compare, Allocator>::maximum(link_type node) const {
+template <typename T, typename KeyOfValue, typename Compare, typename Allocator, typename Policy>
+typename red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::link_type red_black_tree<T, KeyOfValue, Compare, Allocator, Policy>::maximum(link_type node) const {
 	if (!node)
 		node = _root;
 	while (node->right && node->right != _null)
@@ -685,6 +1481,17 @@ typename red_black_tree<T, Compare, Allocator>::link_type red_black_tree<T, Comp
 	return node;
 }
 
+/* With the order_statistics policy, the distance between two iterators is their difference in position */
+
+template <typename T>
+std::ptrdiff_t distance(ft::red_black_tree_iterator<T, ft::node<T, ft::order_statistics> > first, ft::red_black_tree_iterator<T, ft::node<T, ft::order_statistics> > last) {
+	return static_cast<std::ptrdiff_t>(ft::order_statistics::index(last._base, last._null)) - static_cast<std::ptrdiff_t>(ft::order_statistics::index(first._base, first._null));
+}
+
+template <typename T>
+std::ptrdiff_t distance(ft::const_red_black_tree_iterator<T, ft::node<T, ft::order_statistics> > first, ft::const_red_black_tree_iterator<T, ft::node<T, ft::order_statistics> > last) {
+	return static_cast<std::ptrdiff_t>(ft::order_statistics::index(last._base, last._null)) - static_cast<std::ptrdiff_t>(ft::order_statistics::index(first._base, first._null));
+}
 
 } /* FT NAMESPACE */
 
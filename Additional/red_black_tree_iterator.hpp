@@ -262,7 +262,7 @@ template <typename T, typename Node>
 void const_red_black_tree_iterator<T, Node>::increment(void) {
 	if (_base == _null)
 		_base = _base->left;
-	else if (_base->right == _null)
+	else if (_null->right == _base)
 		_base = _null;
 	else if (_base->right) {
 		_base = _base->right;
@@ -284,7 +284,7 @@ template <typename T, typename Node>
 void const_red_black_tree_iterator<T, Node>::decrement(void) {
 	if (_base == _null)
 		_base = _base->right;
-	else if (_base->left == _null)
+	else if (_null->left == _base)
 		_base = _null;
 	else if (_base->left) {
 		_base = _base->left;
@@ -13,23 +13,36 @@
 #ifndef RED_BLACK_TREE_NODE_H
 # define RED_BLACK_TREE_NODE_H
 
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+# include "order_statistics.hpp"
+
 namespace ft
 {
 
 enum node_color {red = true, black = false};
 
-template <typename T>
-class node {
+/* Policy decides what else a node stores, see order_statistics.hpp */
+
+template <typename T, typename Policy = ft::no_order_statistics>
+class node : public Policy::node_data {
 
 public:
-	typedef T			value_type;
-	typedef T*			pointer;
-	typedef	T&			reference;
-	typedef node<T>*	link_type;
+	typedef T							value_type;
+	typedef T*							pointer;
+	typedef	T&							reference;
+	typedef node<T, Policy>*			link_type;
+	typedef Policy						policy_type;
+	typedef typename Policy::node_data	data_type;
 
 
 	node(const value_type& val = value_type());
 	node(const node& other);
+# if __cplusplus >= 201103L
+	template <typename U1, typename U2>
+	node(U1&& first, U2&& second);
+# endif
 	~node();
 
 	node&		operator = (const node& other);
@@ -49,17 +62,26 @@ public:
 	node_color	color;
 };
 
-template <typename T>
-node<T>::node(const value_type& val) : value(val), parent(nullptr), left(nullptr), right(nullptr), color(red) { }
+template <typename T, typename Policy>
+node<T, Policy>::node(const value_type& val) : value(val), parent(nullptr), left(nullptr), right(nullptr), color(red) { }
+
+template <typename T, typename Policy>
+node<T, Policy>::node(const node& other) : data_type(other), value(other.value), parent(other.parent), left(other.left), right(other.right), color(other.color) { }
+
+# if __cplusplus >= 201103L
+
+template <typename T, typename Policy>
+template <typename U1, typename U2>
+node<T, Policy>::node(U1&& first, U2&& second) : value(std::forward<U1>(first), std::forward<U2>(second)), parent(nullptr), left(nullptr), right(nullptr), color(red) { }
 
-template <typename T>
-node<T>::node(const node& other) : value(other.value), parent(other.parent), left(other.left), right(other.right), color(other.color) { }
+# endif
 
-template <typename T>
-node<T>::~node() { }
+template <typename T, typename Policy>
+node<T, Policy>::~node() { }
 
-template <typename T>
-node<T>& node<T>::operator = (const node& other) {
+template <typename T, typename Policy>
+node<T, Policy>& node<T, Policy>::operator = (const node& other) {
+	data_type::operator=(other);
 	parent = other.parent;
 	left = other.left;
 	right = other.right;
@@ -67,13 +89,13 @@ node<T>& node<T>::operator = (const node& other) {
 	return *this;
 }
 
-template <typename T>
-bool node<T>::is_left_child(void) const {
+template <typename T, typename Policy>
+bool node<T, Policy>::is_left_child(void) const {
 	return (parent->left == this ? true : false);
 }
 
-template <typename T>
-typename node<T>::link_type node<T>::distant_cousin(void) {
+template <typename T, typename Policy>
+typename node<T, Policy>::link_type node<T, Policy>::distant_cousin(void) {
 	link_type	sibl = sibling();
 
 	if (!sibl)
@@ -84,8 +106,8 @@ typename node<T>::link_type node<T>::distant_cousin(void) {
 		return sibl->right;
 }
 
-template <typename T>
-typename node<T>::link_type node<T>::close_cousin(void) {
+template <typename T, typename Policy>
+typename node<T, Policy>::link_type node<T, Policy>::close_cousin(void) {
 	link_type	sibl = sibling();
 
 	if (!sibl)
@@ -96,8 +118,8 @@ typename node<T>::link_type node<T>::close_cousin(void) {
 		return sibl->left;
 }
 
-template <typename T>
-typename node<T>::link_type node<T>::grandparent(void) {
+template <typename T, typename Policy>
+typename node<T, Policy>::link_type node<T, Policy>::grandparent(void) {
 	link_type	copy = this;
 
 	if (copy->parent)
@@ -105,8 +127,8 @@ typename node<T>::link_type node<T>::grandparent(void) {
 	return nullptr;
 }
 
-template <typename T>
-typename node<T>::link_type node<T>::sibling(void) {
+template <typename T, typename Policy>
+typename node<T, Policy>::link_type node<T, Policy>::sibling(void) {
 	link_type	copy = this;
 
 	if (copy->parent)
@@ -114,8 +136,8 @@ typename node<T>::link_type node<T>::sibling(void) {
 	return nullptr;
 }
 
-template <typename T>
-typename node<T>::link_type node<T>::uncle(void) {
+template <typename T, typename Policy>
+typename node<T, Policy>::link_type node<T, Policy>::uncle(void) {
 	link_type	copy = this;
 
 	if (copy->parent && copy->parent->parent)
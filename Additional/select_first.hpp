@@ -0,0 +1,35 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   select_first.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:02:31 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 18:02:31 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SELECT_FIRST_H
+# define SELECT_FIRST_H
+
+namespace ft
+{
+
+
+/* Key extractor for containers of pairs: the key is the pair's first member */
+
+template <typename Pair>
+class select_first {
+
+public:
+	typedef Pair						argument_type;
+	typedef typename Pair::first_type	result_type;
+
+	const result_type& operator () (const Pair& x) const { return (x.first); }
+};
+
+
+} /* FT NAMESPACE */
+
+#endif /* SELECT_FIRST_H */
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sorted_unique.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 16:40:12 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 16:40:12 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SORTED_UNIQUE_H
+# define SORTED_UNIQUE_H
+
+namespace ft
+{
+
+
+/* Tag telling a map || set constructor that its range is already sorted and free of duplicates */
+
+class sorted_unique_t {
+
+public:
+	sorted_unique_t() { }
+};
+
+const sorted_unique_t	sorted_unique = sorted_unique_t();
+
+
+} /* FT NAMESPACE */
+
+#endif /* SORTED_UNIQUE_H */
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:21:37 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 01:58:40 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include <chrono>
+# include <cstddef>
+# include <cstdlib>
+# include <iterator>
+# include <new>
+# include <stdexcept>
+
+/* Helpers shared by the programs in bench/. Each program includes this header first,
+   then the containers it measures, and prints its own table. The standard headers
+   above are the ones the containers expect their users to include. */
+
+namespace bench
+{
+
+
+/* Wall time since construction or the last restart(), in milliseconds */
+
+class timer {
+
+public:
+	timer(void) : _start(clock::now()) { }
+
+	void	restart(void) { _start = clock::now(); }
+	double	ms(void) const { return std::chrono::duration<double, std::milli>(clock::now() - _start).count(); }
+
+private:
+	typedef std::chrono::steady_clock	clock;
+
+	clock::time_point	_start;
+};
+
+/* Mean and best wall time of runs calls to f, in milliseconds */
+
+template <typename F>
+double	mean_of(int runs, F f) {
+	timer	timer;
+
+	for (int i = 0; i < runs; ++i)
+		f();
+	return timer.ms() / runs;
+}
+
+template <typename F>
+double	best_of(int runs, F f) {
+	double	best = 0;
+
+	for (int i = 0; i < runs; ++i) {
+		timer	timer;
+
+		f();
+		double	elapsed = timer.ms();
+		if (i == 0 || elapsed < best)
+			best = elapsed;
+	}
+	return best;
+}
+
+/* Keeps the optimizer from dropping a value that is computed only to be measured */
+
+template <typename T>
+inline void	keep(const T& value) { asm volatile("" : : "r"(&value) : "memory"); }
+
+/* Allocation counters, filled in by the operator new below when BENCH_COUNT_ALLOCATIONS is defined */
+
+struct allocations {
+	static std::size_t	calls;
+	static std::size_t	bytes;
+	static std::size_t	peak;
+
+	static void	reset(void) { calls = 0; bytes = 0; peak = 0; }
+};
+
+std::size_t	allocations::calls = 0;
+std::size_t	allocations::bytes = 0;
+std::size_t	allocations::peak = 0;
+
+
+}; /* BENCH NAMESPACE */
+
+/* Replacing the global operator new in a header is only fine because every
+   bench program is a single translation unit. Each block keeps its size in a
+   16-byte prefix, so that operator delete can take it off the live byte count. */
+
+# ifdef BENCH_COUNT_ALLOCATIONS
+
+void*	operator new(std::size_t n) {
+	std::size_t*	block = static_cast<std::size_t*>(std::malloc(n + 16));
+
+	if (!block)
+		throw std::bad_alloc();
+	*block = n;
+	++bench::allocations::calls;
+	bench::allocations::bytes += n;
+	if (bench::allocations::bytes > bench::allocations::peak)
+		bench::allocations::peak = bench::allocations::bytes;
+	return reinterpret_cast<char*>(block) + 16;
+}
+
+void	operator delete(void* p) noexcept {
+	if (!p)
+		return ;
+	std::size_t*	block = reinterpret_cast<std::size_t*>(static_cast<char*>(p) - 16);
+
+	bench::allocations::bytes -= *block;
+	std::free(block);
+}
+
+void	operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+# endif /* BENCH_COUNT_ALLOCATIONS */
+
+#endif /* BENCH_H */
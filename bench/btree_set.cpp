@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:51:19 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 05:51:19 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* std::set, ft::set and ft::btree_set of ints: N random inserts, N finds (half of them hits),
+   a full scan, N / 10 lower_bound calls each followed by 100 increments, and N / 2 erases.
+   N is the first argument, 10M by default. Keys come from a fixed seed.
+   There is no "before" build: btree_set was added by [user-020]. */
+
+#include "bench.hpp"
+#include "set.hpp"
+#include "btree_set.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+
+template <typename Set>
+void	run(const char* name, const std::vector<int>& keys, const std::vector<int>& probes) {
+	Set				set;
+	long			sum = 0;
+	bench::timer	timer;
+
+	for (std::size_t i = 0; i < keys.size(); ++i)
+		set.insert(keys[i]);
+	double	insert = timer.ms();
+
+	timer.restart();
+	for (std::size_t i = 0; i < probes.size(); ++i)
+		sum += set.find(probes[i]) != set.end();
+	double	find = timer.ms();
+
+	timer.restart();
+	for (typename Set::const_iterator it = set.begin(); it != set.end(); ++it)
+		sum += *it;
+	double	scan = timer.ms();
+
+	timer.restart();
+	for (std::size_t i = 0; i < probes.size() / 10; ++i) {
+		typename Set::const_iterator	it = set.lower_bound(probes[i]);
+
+		for (int j = 0; j < 100 && it != set.end(); ++j, ++it)
+			sum += *it;
+	}
+	double	range = timer.ms();
+
+	timer.restart();
+	for (std::size_t i = 0; i < keys.size(); i += 2)
+		set.erase(keys[i]);
+	double	erase = timer.ms();
+
+	bench::keep(sum);
+	std::printf("%-10s %7.0f %7.0f %10.0f %20.0f %10.0f\n", name, insert, find, scan, range, erase);
+}
+
+int	main(int argc, char** argv) {
+	const std::size_t	count = argc > 1 ? std::atol(argv[1]) : 10000000;
+	std::mt19937		random(1);
+	std::vector<int>	keys(count);
+	std::vector<int>	probes(count);
+
+	for (std::size_t i = 0; i < count; ++i)
+		keys[i] = random() & 0x7fffffff;
+	for (std::size_t i = 0; i < count; ++i)
+		probes[i] = (i & 1) ? keys[random() % count] : static_cast<int>(random() & 0x7fffffff);
+
+	std::printf("%-10s %7s %7s %10s %20s %10s\n", "ms", "insert", "find", "full scan", "lower_bound+100", "erase N/2");
+	run<std::set<int> >("std::set", keys, probes);
+	run<ft::set<int> >("ft::set", keys, probes);
+	run<ft::btree_set<int> >("btree_set", keys, probes);
+	return 0;
+}
@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque_blocks.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:24:12 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 01:24:12 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Block size of ft::deque: 10M push_back, then 10M pop_front on a deque<int>.
+   Prints the time of each phase, the peak heap bytes per element and the number of allocations.
+   For the "before" column, build against the tree before [user-002] with -DBASELINE. */
+
+#define BENCH_COUNT_ALLOCATIONS
+#include "bench.hpp"
+#include "deque.hpp"
+
+#include <iostream>
+
+template <typename Deque>
+void	run(const char* name) {
+	const int		count = 10000000;
+	Deque			deque;
+	bench::timer	timer;
+	long			sum = 0;
+
+	bench::allocations::reset();
+	for (int i = 0; i < count; ++i)
+		deque.push_back(i);
+	double		push = timer.ms();
+	std::size_t	peak = bench::allocations::peak;
+	std::size_t	calls = bench::allocations::calls;
+
+	timer.restart();
+	while (!deque.empty()) {
+		sum += deque.front();
+		deque.pop_front();
+	}
+	double		pop = timer.ms();
+
+	bench::keep(sum);
+	std::cout << name << ": push_back " << push << " ms, pop_front " << pop << " ms, "
+		<< static_cast<double>(peak) / count << " B/elem, " << calls << " allocs" << std::endl;
+}
+
+int	main(void) {
+	run<ft::deque<int> >("default blocks");
+#ifndef BASELINE
+	run<ft::deque<int, std::allocator<int>, 4096> >("4 KiB blocks");
+#endif
+	return 0;
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque_bulk.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:03:18 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 02:03:18 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Bulk construct, assign, resize and insert of ft::deque: mean of 20 runs, 1M ints each.
+   For the "before" column, build against the tree before [user-004] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "deque.hpp"
+
+#include <cstdio>
+#include <vector>
+
+int	main(void) {
+	const std::size_t		count = 1000000;
+	const int				runs = 20;
+	const std::vector<int>	values(count, 7);
+	const ft::deque<int>	source(count, 3);
+	long					sum = 0;
+
+	std::printf("deque(n, val)            %6.2f ms\n", bench::mean_of(runs, [&] {
+		ft::deque<int>	deque(count, 1);
+		sum += deque[count / 2];
+	}));
+	std::printf("deque(const deque&)      %6.2f ms\n", bench::mean_of(runs, [&] {
+		ft::deque<int>	deque(source);
+		sum += deque[count / 2];
+	}));
+	std::printf("assign(n, val)           %6.2f ms\n", bench::mean_of(runs, [&] {
+		ft::deque<int>	deque;
+		deque.assign(count, 2);
+		sum += deque[count / 2];
+	}));
+	std::printf("insert(end, ptr, ptr+n)  %6.2f ms\n", bench::mean_of(runs, [&] {
+		ft::deque<int>	deque;
+		deque.insert(deque.end(), values.data(), values.data() + count);
+		sum += deque[count / 2];
+	}));
+	std::printf("resize(n)                %6.2f ms\n", bench::mean_of(runs, [&] {
+		ft::deque<int>	deque;
+		deque.resize(count);
+		sum += deque[count / 2];
+	}));
+	bench::keep(sum);
+	return 0;
+}
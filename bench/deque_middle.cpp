@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque_middle.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:14:51 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 02:14:51 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Middle insert and erase of ft::deque: 2000 insert + erase pairs at 1%, 50% and 99% of a
+   100K-element deque, for int and for 20-char std::string. Prints the cost per operation.
+   For the "before" column, build against the tree before [user-005] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "deque.hpp"
+
+#include <cstdio>
+#include <string>
+
+static int			make(int i, int*) { return i; }
+static std::string	make(int i, std::string*) { return std::string(20, 'a' + i % 26); }
+
+template <typename T>
+void	run(const char* name) {
+	const int		count = 100000;
+	const int		pairs = 2000;
+	const double	where[3] = { 0.01, 0.5, 0.99 };
+
+	for (int w = 0; w < 3; ++w) {
+		ft::deque<T>	deque;
+
+		for (int i = 0; i < count; ++i)
+			deque.push_back(make(i, static_cast<T*>(0)));
+
+		bench::timer	timer;
+		for (int i = 0; i < pairs; ++i) {
+			std::size_t	position = static_cast<std::size_t>(deque.size() * where[w]);
+
+			deque.insert(deque.begin() + position, make(i, static_cast<T*>(0)));
+			deque.erase(deque.begin() + position + 1);
+		}
+		std::printf("%-6s %3d%%  %8.1f us/op\n", name, static_cast<int>(where[w] * 100), timer.ms() * 1000 / pairs / 2);
+	}
+}
+
+int	main(void) {
+	run<int>("int");
+	run<std::string>("string");
+	return 0;
+}
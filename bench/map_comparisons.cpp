@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_comparisons.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:24:57 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 06:24:57 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Comparator calls per lookup in ft::map<std::string, int>: N inserts, then Q probes (half of them hits)
+   through find, count, lower_bound, upper_bound, equal_range and operator[]. Prints the average number
+   of comparisons and the time of each. N and Q are the first two arguments, 1M and 1M by default;
+   "10000 3000000" gives a map that stays in cache. Keys come from a fixed seed.
+   For the "before" column, build against the tree before [user-022] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+static long	comparisons = 0;
+
+struct counting_less {
+	bool	operator () (const std::string& lhs, const std::string& rhs) const {
+		++comparisons;
+		return lhs < rhs;
+	}
+};
+
+typedef ft::map<std::string, int, counting_less>	counted_map;
+
+template <typename F>
+void	run(const char* name, int count, F f) {
+	long			sum = 0;
+	bench::timer	timer;
+
+	comparisons = 0;
+	for (int i = 0; i < count; ++i)
+		sum += f(i);
+	double	elapsed = timer.ms();
+
+	bench::keep(sum);
+	std::printf("%-12s %5.1f compares/op %7.0f ms\n", name, static_cast<double>(comparisons) / count, elapsed);
+}
+
+int	main(int argc, char** argv) {
+	const int					count = argc > 1 ? std::atoi(argv[1]) : 1000000;
+	const int					queries = argc > 2 ? std::atoi(argv[2]) : 1000000;
+	std::mt19937				random(7);
+	std::vector<std::string>	keys;
+	std::vector<std::string>	probes;
+	counted_map					map;
+
+	for (int i = 0; i < count; ++i)
+		keys.push_back("tenant/" + std::to_string(random() % 100000000));
+	for (int i = 0; i < queries; ++i)
+		probes.push_back((i & 1) ? keys[random() % count] : "tenant/" + std::to_string(random() % 100000000));
+
+	run("insert", count, [&] (int i) { return map.insert(ft::make_pair(keys[i], i)).second; });
+	run("find", queries, [&] (int i) { return map.find(probes[i]) != map.end(); });
+	run("count", queries, [&] (int i) { return map.count(probes[i]); });
+	run("lower_bound", queries, [&] (int i) { return map.lower_bound(probes[i]) != map.end(); });
+	run("upper_bound", queries, [&] (int i) { return map.upper_bound(probes[i]) != map.end(); });
+	run("equal_range", queries, [&] (int i) { return map.equal_range(probes[i]).first != map.end(); });
+	run("operator[]", queries, [&] (int i) { return map[probes[i]]; });
+	return 0;
+}
@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_copy.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:02:48 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 05:02:48 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Copying ft::map<int, long> with 500K random keys: copy construct + destroy, best of 5, and
+   operator= into a snapshot after each of 20 one-key changes, best and worst.
+   For the "before" column, build against the tree before [user-017] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+int	main(void) {
+	ft::map<int, long>	live;
+	double				best = 0;
+	double				worst = 0;
+
+	std::srand(4);
+	for (int i = 0; i < 500000; ++i)
+		live[std::rand()] = i;
+
+	double	copy = bench::best_of(5, [&] {
+		ft::map<int, long>	other(live);
+
+		bench::keep(other.size());
+	});
+
+	ft::map<int, long>	snapshot(live);
+
+	for (int i = 0; i < 20; ++i) {
+		live[std::rand()] = i;
+		live.erase(live.begin());
+
+		bench::timer	timer;
+
+		snapshot = live;
+		double	elapsed = timer.ms();
+		if (i == 0 || elapsed < best)
+			best = elapsed;
+		if (elapsed > worst)
+			worst = elapsed;
+	}
+	bench::keep(snapshot.size());
+	std::printf("copy construct + destroy   %6.1f ms\n", copy);
+	std::printf("operator= snapshot         best %6.1f ms, worst %6.1f ms\n", best, worst);
+	return 0;
+}
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_erase.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:17:06 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 05:17:06 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Erase by key in ft::map: 1M random keys erased one by one from map<int, std::string> with
+   32-char values and from map<int, int>, best of 5. Keys come from a fixed seed.
+   For the "before" column, build against the tree before [user-018] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+static std::vector<int>	keys;
+
+template <typename T>
+double	erase_all(const T& value) {
+	double	best = 0;
+
+	for (int i = 0; i < 5; ++i) {
+		ft::map<int, T>	map;
+		long			erased = 0;
+
+		for (std::size_t j = 0; j < keys.size(); ++j)
+			map.insert(ft::make_pair(keys[j], value));
+
+		bench::timer	timer;
+		for (std::size_t j = 0; j < keys.size(); ++j)
+			erased += map.erase(keys[j]);
+		double	elapsed = timer.ms();
+		if (i == 0 || elapsed < best)
+			best = elapsed;
+		bench::keep(erased);
+	}
+	return best;
+}
+
+int	main(void) {
+	std::srand(9);
+	for (int i = 0; i < 1000000; ++i)
+		keys.push_back(std::rand());
+	std::printf("map<int, std::string(32)>  %7.1f ms\n", erase_all(std::string(32, 'x')));
+	std::printf("map<int, int>              %7.1f ms\n", erase_all(1));
+	return 0;
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_hints.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:31:06 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 03:31:06 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Insertion hints in ft::map<int, int>: a 2M-key sorted stream inserted without a hint and at end(),
+   and a reverse stream inserted before the previous result. The unhinted run goes first, on a fresh
+   heap, since the order in which a map frees its nodes changes how the next map is laid out.
+   For the "before" column, build against the tree before [user-012] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+
+int	main(void) {
+	const int	count = 2000000;
+
+	{
+		ft::map<int, int>	map;
+		bench::timer		timer;
+
+		for (int i = 0; i < count; ++i)
+			map.insert(ft::make_pair(i, i));
+		std::printf("sorted,  insert(v)                   %6.0f ms\n", timer.ms());
+	}
+	{
+		ft::map<int, int>	map;
+		bench::timer		timer;
+
+		for (int i = 0; i < count; ++i)
+			map.insert(map.end(), ft::make_pair(i, i));
+		std::printf("sorted,  insert(end(), v)            %6.0f ms\n", timer.ms());
+	}
+	{
+		ft::map<int, int>			map;
+		ft::map<int, int>::iterator	hint = map.end();
+		bench::timer				timer;
+
+		for (int i = count; i > 0; --i)
+			hint = map.insert(hint, ft::make_pair(i, i));
+		std::printf("reverse, insert(previous result, v)  %6.0f ms\n", timer.ms());
+	}
+	return 0;
+}
@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_insert_erase.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:15:31 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 03:15:31 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Insert and erase in ft::map<int, int>: random, duplicate and sequential inserts, then random
+   erases, of N keys shuffled from a fixed seed. N is the first argument, 5M by default.
+   For the "before" column, build against the tree before [user-011] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static void	report(const char* name, double elapsed, int count) {
+	std::printf("%-18s %8.0f ms  %6.2f Mops/s\n", name, elapsed, count / elapsed / 1000);
+}
+
+int	main(int argc, char** argv) {
+	const int			count = argc > 1 ? std::atoi(argv[1]) : 5000000;
+	std::vector<int>	keys(count);
+
+	for (int i = 0; i < count; ++i)
+		keys[i] = i;
+	std::srand(1);
+	for (int i = count - 1; i > 0; --i)
+		std::swap(keys[i], keys[std::rand() % (i + 1)]);
+
+	{
+		ft::map<int, int>	map;
+		bench::timer		timer;
+
+		for (int i = 0; i < count; ++i)
+			map.insert(ft::make_pair(keys[i], i));
+		report("random insert", timer.ms(), count);
+
+		timer.restart();
+		for (int i = 0; i < count; ++i)
+			map.insert(ft::make_pair(keys[i], i));
+		report("duplicate insert", timer.ms(), count);
+
+		timer.restart();
+		for (int i = 0; i < count; ++i)
+			map.erase(keys[i]);
+		report("random erase", timer.ms(), count);
+	}
+	{
+		ft::map<int, int>	map;
+		bench::timer		timer;
+
+		for (int i = 0; i < count; ++i)
+			map.insert(ft::make_pair(i, i));
+		report("sequential insert", timer.ms(), count);
+	}
+	return 0;
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_sorted_build.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:52:20 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 03:52:20 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Linear-time build of ft::map<int, int> from a sorted range of 2M pairs, and a copy of the result,
+   best of 5. For the "before" column, build against the tree before [user-013] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+#include <vector>
+
+int	main(void) {
+	const int						count = 2000000;
+	const int						runs = 5;
+	std::vector<ft::pair<int, int> >	values;
+	double							build = 0;
+	double							copy = 0;
+
+	for (int i = 0; i < count; ++i)
+		values.push_back(ft::make_pair(i, i));
+	for (int i = 0; i < runs; ++i) {
+		bench::timer		timer;
+		ft::map<int, int>	map(values.begin(), values.end());
+		double				elapsed = timer.ms();
+
+		if (i == 0 || elapsed < build)
+			build = elapsed;
+		timer.restart();
+		ft::map<int, int>	other(map);
+		elapsed = timer.ms();
+		if (i == 0 || elapsed < copy)
+			copy = elapsed;
+		bench::keep(other);
+	}
+	std::printf("range ctor  %6.1f ms\ncopy ctor   %6.1f ms\n", build, copy);
+	return 0;
+}
@@ -0,0 +1,67 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_string_find.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:37:12 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 04:37:12 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Key lookups in ft::map<std::string, std::string>: 200K finds of 27-char keys, by std::string
+   and by const char*, and by const char* through the transparent ft::less<>, best of 5.
+   For the "before" column, build against the tree before [user-015] with -DBASELINE,
+   which leaves out the transparent run. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static std::vector<std::string>	keys;
+
+template <typename Map, typename Key>
+double	find_all(const Map& map, Key (*key)(const std::string&)) {
+	return bench::best_of(5, [&] {
+		long	hits = 0;
+
+		for (std::size_t i = 0; i < keys.size(); ++i)
+			hits += map.find(key(keys[i])) != map.end();
+		bench::keep(hits);
+	});
+}
+
+static const std::string&	as_string(const std::string& key) { return key; }
+static const char*			as_chars(const std::string& key) { return key.c_str(); }
+
+template <typename Map>
+void	fill(Map& map) {
+	for (std::size_t i = 0; i < keys.size(); ++i)
+		map.insert(ft::make_pair(keys[i], std::string(40, 'v')));
+}
+
+int	main(void) {
+	char	buffer[64];
+
+	for (int i = 0; i < 200000; ++i) {
+		std::snprintf(buffer, sizeof(buffer), "symbol/table/entry/%08d", (i * 7919) % 200000);
+		keys.push_back(buffer);
+	}
+
+	ft::map<std::string, std::string>	map;
+
+	fill(map);
+	std::printf("find(std::string)                  %6.1f ms\n", find_all(map, as_string));
+	std::printf("find(const char*)                  %6.1f ms\n", find_all(map, as_chars));
+#ifndef BASELINE
+	ft::map<std::string, std::string, ft::less<> >	transparent;
+
+	fill(transparent);
+	std::printf("find(const char*) with ft::less<>  %6.1f ms\n", find_all(transparent, as_chars));
+#endif
+	return 0;
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   map_subscript.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:49:30 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 04:49:30 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* operator[] of ft::map: 4M m[int]++ over 200K keys and 1M m[string]++ over 50K keys, best of 5.
+   Keys come from a fixed seed.
+   For the "before" column, build against the tree before [user-016] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+template <typename Key>
+double	count_all(const std::vector<Key>& keys) {
+	return bench::best_of(5, [&] {
+		ft::map<Key, long>	map;
+
+		for (std::size_t i = 0; i < keys.size(); ++i)
+			map[keys[i]]++;
+		bench::keep(map.size());
+	});
+}
+
+int	main(void) {
+	std::vector<int>			keys;
+	std::vector<std::string>	names;
+	char						buffer[64];
+
+	std::srand(3);
+	for (int i = 0; i < 4000000; ++i)
+		keys.push_back(std::rand() % 200000);
+	for (int i = 0; i < 1000000; ++i) {
+		std::snprintf(buffer, sizeof(buffer), "counter/name/%07d", keys[i] % 50000);
+		names.push_back(buffer);
+	}
+	std::printf("4M m[int]++ over 200K keys     %7.1f ms\n", count_all(keys));
+	std::printf("1M m[string]++ over 50K keys   %7.1f ms\n", count_all(names));
+	return 0;
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multimap.cpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:08:41 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 06:08:41 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* ft::multimap<int, int> against ft::map<int, ft::vector<int> > for 2M values over 200K keys, best of 3:
+   inserting every value, then visiting the values of every key and counting them.
+   Keys come from a fixed seed. There is no "before" build: multimap was added by [user-021]. */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "multimap.hpp"
+#include "vector.hpp"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+int	main(void) {
+	typedef ft::multimap<int, int>			multi;
+	typedef ft::map<int, ft::vector<int> >	grouped;
+
+	const int			count = 2000000;
+	const int			distinct = 200000;
+	std::mt19937		random(2);
+	std::vector<int>	keys(count);
+	double				best[4] = { 0, 0, 0, 0 };
+	long				sum = 0;
+
+	for (int i = 0; i < count; ++i)
+		keys[i] = random() % distinct;
+	for (int run = 0; run < 3; ++run) {
+		double			elapsed[4];
+		multi			multimap;
+		grouped			map;
+		bench::timer	timer;
+
+		for (int i = 0; i < count; ++i)
+			multimap.insert(ft::make_pair(keys[i], i));
+		elapsed[0] = timer.ms();
+
+		timer.restart();
+		for (int key = 0; key < distinct; ++key) {
+			ft::pair<multi::iterator, multi::iterator>	range = multimap.equal_range(key);
+
+			for (; range.first != range.second; ++range.first)
+				sum += range.first->second;
+			sum += multimap.count(key);
+		}
+		elapsed[1] = timer.ms();
+
+		timer.restart();
+		for (int i = 0; i < count; ++i)
+			map[keys[i]].push_back(i);
+		elapsed[2] = timer.ms();
+
+		timer.restart();
+		for (int key = 0; key < distinct; ++key) {
+			grouped::iterator	it = map.find(key);
+
+			if (it == map.end())
+				continue ;
+			for (std::size_t i = 0; i < it->second.size(); ++i)
+				sum += it->second[i];
+			sum += it->second.size();
+		}
+		elapsed[3] = timer.ms();
+
+		for (int i = 0; i < 4; ++i)
+			if (run == 0 || elapsed[i] < best[i])
+				best[i] = elapsed[i];
+	}
+	bench::keep(sum);
+	std::printf("%-28s %8s %8s\n", "ms", "insert", "scan");
+	std::printf("%-28s %8.0f %8.0f\n", "ft::multimap<int, int>", best[0], best[1]);
+	std::printf("%-28s %8.0f %8.0f\n", "ft::map<int, vector<int> >", best[2], best[3]);
+	return 0;
+}
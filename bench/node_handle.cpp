@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_handle.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 07:09:44 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 07:09:44 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Moving 1M entries of ft::map<int, std::string> with 40-char values from one map to another, with
+   extract and insert(node_type), and with insert(*it) and erase(it). Each way runs twice.
+   There is no "before" build: node handles were added by [user-025]. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+#include <string>
+
+typedef ft::map<int, std::string>	string_map;
+
+int	main(void) {
+	const int	count = 1000000;
+	string_map	from;
+	string_map	to;
+
+	for (int i = 0; i < count; ++i)
+		from.insert(ft::make_pair(static_cast<int>((i * 2654435761u) % count), std::string(40, 'x')));
+	for (int run = 0; run < 2; ++run) {
+		bench::timer	timer;
+
+		for (int i = 0; i < count; ++i)
+			to.insert(from.extract(i));
+		double	moved = timer.ms();
+
+		timer.restart();
+		for (int i = 0; i < count; ++i) {
+			string_map::iterator	it = to.find(i);
+
+			from.insert(*it);
+			to.erase(it);
+		}
+		double	copied = timer.ms();
+
+		std::printf("extract + insert(node) %6.0f ms, insert(*it) + erase(it) %6.0f ms\n", moved, copied);
+	}
+	bench::keep(from.size());
+	return 0;
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_pool.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 04:21:43 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 04:21:43 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* ft::node_pool_allocator against std::allocator for map<int, int> nodes, best of 9:
+   20K short-lived maps of 64 inserts and 64 erase/insert pairs each, and 2M erase(begin)/insert
+   pairs on a 100K-element map. Keys come from a fixed seed.
+   There is no "before" build: both allocators are measured in the same program. */
+
+#include "bench.hpp"
+#include "map.hpp"
+#include "Additional/node_pool_allocator.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+static std::vector<int>	keys;
+
+template <typename Map>
+void	short_lived(void) {
+	for (int i = 0; i < 20000; ++i) {
+		Map			map;
+		const int*	key = &keys[(i * 64) & 65535];
+
+		for (int j = 0; j < 64; ++j)
+			map.insert(ft::make_pair(key[j], j));
+		for (int j = 0; j < 64; ++j) {
+			map.erase(key[j]);
+			map.insert(ft::make_pair(key[j] + 1, j));
+		}
+		bench::keep(map.size());
+	}
+}
+
+template <typename Map>
+double	churn(void) {
+	Map				map;
+	bench::timer	timer;
+
+	for (int i = 0; i < 100000; ++i)
+		map.insert(ft::make_pair(keys[i & 65535] * 16 + (i >> 16), i));
+	timer.restart();
+	for (int i = 0; i < 2000000; ++i) {
+		map.erase(map.begin());
+		map.insert(ft::make_pair(keys[i & 65535] + i, i));
+	}
+	bench::keep(map.size());
+	return timer.ms();
+}
+
+int	main(void) {
+	typedef ft::map<int, int>	plain;
+	typedef ft::map<int, int, ft::less<int>, ft::node_pool_allocator<ft::pair<const int, int> > >	pooled;
+
+	const int	runs = 9;
+	double		churned[2] = { 0, 0 };
+
+	std::srand(1);
+	for (int i = 0; i < 65536 + 64; ++i)
+		keys.push_back(std::rand() & 0xfffff);
+
+	double	lived[2] = { bench::best_of(runs, short_lived<plain>), bench::best_of(runs, short_lived<pooled>) };
+	for (int i = 0; i < runs; ++i) {
+		double	elapsed[2] = { churn<plain>(), churn<pooled>() };
+
+		for (int j = 0; j < 2; ++j)
+			if (i == 0 || elapsed[j] < churned[j])
+				churned[j] = elapsed[j];
+	}
+	std::printf("20K short-lived maps:      std::allocator %6.1f ms, node_pool_allocator %6.1f ms\n", lived[0], lived[1]);
+	std::printf("2M churn on a 100K map:    std::allocator %6.1f ms, node_pool_allocator %6.1f ms\n", churned[0], churned[1]);
+	return 0;
+}
@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   order_statistics.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 05:33:52 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 05:33:52 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* The order_statistics policy of ft::set<int> with 1M elements: 99 percentile lookups with nth
+   against std::advance from begin(), 99 ft::distance calls, and the cost of keeping the counts
+   over 1M random inserts and 500K erases, best of 5.
+   For the "before" column, build against the tree before [user-019] with -DBASELINE, which only
+   keeps the plain insert/erase run. */
+
+#include "bench.hpp"
+#include "set.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+
+typedef ft::set<int>	plain;
+#ifndef BASELINE
+typedef ft::set<int, ft::less<int>, std::allocator<int>, ft::order_statistics>	counted;
+#endif
+
+template <typename Set>
+double	insert_erase(const std::vector<int>& values) {
+	return bench::best_of(5, [&] {
+		Set	set;
+
+		for (std::size_t i = 0; i < values.size(); ++i)
+			set.insert(values[i]);
+		for (std::size_t i = 0; i < values.size(); i += 2)
+			set.erase(values[i]);
+		bench::keep(set.size());
+	});
+}
+
+int	main(void) {
+	const int			count = 1000000;
+	std::vector<int>	values;
+
+	std::srand(3);
+	for (int i = 0; i < count; ++i)
+		values.push_back(std::rand());
+
+#ifndef BASELINE
+	counted			set;
+	plain			other;
+	long			sum = 0;
+	bench::timer	timer;
+
+	for (int i = 0; i < count; ++i) {
+		set.insert(i * 7 % 1000003);
+		other.insert(i * 7 % 1000003);
+	}
+
+	timer.restart();
+	for (int i = 1; i < 100; ++i)
+		sum += *set.nth(set.size() * i / 100);
+	std::printf("99 percentiles, nth                  %9.1f us\n", timer.ms() * 1000);
+
+	timer.restart();
+	for (int i = 1; i < 100; ++i) {
+		plain::iterator	it = other.begin();
+
+		std::advance(it, other.size() * i / 100);
+		sum += *it;
+	}
+	std::printf("99 percentiles, std::advance         %9.1f us\n", timer.ms() * 1000);
+
+	timer.restart();
+	for (int i = 1; i < 100; ++i)
+		sum += ft::distance(set.begin(), set.find(i * 10007));
+	std::printf("99 ft::distance calls                %9.1f us\n", timer.ms() * 1000);
+	bench::keep(sum);
+#endif
+
+	std::printf("1M inserts + 500K erases, plain      %9.0f ms\n", insert_erase<plain>(values));
+#ifndef BASELINE
+	std::printf("1M inserts + 500K erases, counted    %9.0f ms\n", insert_erase<counted>(values));
+#endif
+	return 0;
+}
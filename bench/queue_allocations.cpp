@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   queue_allocations.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:47:05 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 01:47:05 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Spare block cache of ft::deque: calls to operator new made by 1M push/pop pairs on a
+   queue<int> that stays 1000 deep, after a warm-up. For the "before" column, build against
+   the tree before [user-003] with -DBASELINE. */
+
+#define BENCH_COUNT_ALLOCATIONS
+#include "bench.hpp"
+#include "queue.hpp"
+
+#include <iostream>
+
+int	main(void) {
+	const int		depth = 1000;
+	const int		rounds = 1000000;
+	ft::queue<int>	queue;
+	long			sum = 0;
+
+	for (int i = 0; i < depth; ++i)
+		queue.push(i);
+	for (int i = 0; i < depth; ++i) {
+		queue.push(i);
+		queue.pop();
+	}
+
+	bench::allocations::reset();
+	bench::timer	timer;
+	for (int i = 0; i < rounds; ++i) {
+		queue.push(i);
+		sum += queue.front();
+		queue.pop();
+	}
+	double	elapsed = timer.ms();
+
+	bench::keep(sum);
+	std::cout << rounds << " push/pop pairs at depth " << depth << ": " << elapsed << " ms, "
+		<< bench::allocations::calls << " allocs" << std::endl;
+	return 0;
+}
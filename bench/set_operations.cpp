@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   set_operations.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:41:13 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 06:41:13 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* ft::set_union, set_intersection and set_difference on ft::set<int>, against the naive way: copy one
+   operand, then insert or look up the other operand's keys one by one. Sizes 1M/1M, 1K/1M and 1M/1K,
+   keys from a fixed seed; each case runs twice and the second run is printed.
+   There is no "before" build: the set operations were added by [user-023]. */
+
+#include "bench.hpp"
+#include "set.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+typedef ft::set<int>	int_set;
+
+static int_set	naive_union(const int_set& a, const int_set& b) {
+	int_set	result(a);
+
+	for (int_set::const_iterator it = b.begin(); it != b.end(); ++it)
+		result.insert(*it);
+	return result;
+}
+
+static int_set	naive_intersection(const int_set& a, const int_set& b) {
+	int_set	result;
+
+	for (int_set::const_iterator it = a.begin(); it != a.end(); ++it)
+		if (b.count(*it))
+			result.insert(*it);
+	return result;
+}
+
+static int_set	naive_difference(const int_set& a, const int_set& b) {
+	int_set	result;
+
+	for (int_set::const_iterator it = a.begin(); it != a.end(); ++it)
+		if (!b.count(*it))
+			result.insert(*it);
+	return result;
+}
+
+template <typename F>
+double	measure(F f) {
+	bench::timer	timer;
+	int_set			result = f();
+	double			elapsed = timer.ms();
+
+	bench::keep(result.size());
+	return elapsed;
+}
+
+static void	run(int size_a, int size_b) {
+	int_set	a;
+	int_set	b;
+	double	elapsed[6];
+
+	std::srand(7);
+	while (static_cast<int>(a.size()) < size_a)
+		a.insert(std::rand() % (4 * (size_a + size_b)));
+	while (static_cast<int>(b.size()) < size_b)
+		b.insert(std::rand() % (4 * (size_a + size_b)));
+	for (int i = 0; i < 2; ++i) {
+		elapsed[0] = measure([&] { return naive_union(a, b); });
+		elapsed[1] = measure([&] { return ft::set_union(a, b); });
+		elapsed[2] = measure([&] { return naive_intersection(a, b); });
+		elapsed[3] = measure([&] { return ft::set_intersection(a, b); });
+		elapsed[4] = measure([&] { return naive_difference(a, b); });
+		elapsed[5] = measure([&] { return ft::set_difference(a, b); });
+	}
+	std::printf("%7d %7d  %8.1f /%7.1f  %8.1f /%7.1f  %8.1f /%7.1f\n", size_a, size_b,
+		elapsed[0], elapsed[1], elapsed[2], elapsed[3], elapsed[4], elapsed[5]);
+}
+
+int	main(void) {
+	std::printf("%7s %7s  %17s  %17s  %17s\n", "|a|", "|b|", "union naive/ft", "inter naive/ft", "diff naive/ft");
+	run(1000000, 1000000);
+	run(1000, 1000000);
+	run(1000000, 1000);
+	return 0;
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 03:02:55 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 03:02:55 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Inline storage of ft::small_vector: 1M containers of 5 ints, each built and destroyed,
+   as a vector<int> and as a small_vector<int, 8>. Prints the time and the calls to operator new.
+   There is no "before" build: small_vector was added by [user-010]. */
+
+#define BENCH_COUNT_ALLOCATIONS
+#include "bench.hpp"
+#include "small_vector.hpp"
+
+#include <cstdio>
+
+template <typename Vector>
+void	run(const char* name) {
+	const int		count = 1000000;
+	long			sum = 0;
+	bench::timer	timer;
+
+	bench::allocations::reset();
+	for (int i = 0; i < count; ++i) {
+		Vector	vector;
+
+		for (int j = 0; j < 5; ++j)
+			vector.push_back(i + j);
+		sum += vector[4];
+	}
+	double	elapsed = timer.ms();
+
+	bench::keep(sum);
+	std::printf("%-22s %6.1f ms  %8zu allocs\n", name, elapsed, bench::allocations::calls);
+}
+
+int	main(void) {
+	run<ft::vector<int> >("vector<int>");
+	run<ft::small_vector<int, 8> >("small_vector<int, 8>");
+	return 0;
+}
@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   split_join.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 06:58:02 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 06:58:02 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* split_at and merge_disjoint on ft::map<int, int> with 5M entries, with and without the
+   order_statistics policy, against copying the upper half into another map and erasing it.
+   There is no "before" build: split_at and merge_disjoint were added by [user-024]. */
+
+#include "bench.hpp"
+#include "map.hpp"
+
+#include <cstdio>
+
+typedef ft::map<int, int>	plain;
+typedef ft::map<int, int, ft::less<int>, std::allocator<ft::pair<const int, int> >, ft::order_statistics>	counted;
+
+static const int	count = 5000000;
+
+template <typename Map>
+void	split_join(const char* name, Map& map, int at) {
+	bench::timer	timer;
+	Map				upper = map.split_at(at);
+	double			split = timer.ms();
+
+	timer.restart();
+	map.merge_disjoint(upper);
+	std::printf("%-36s split %9.3f ms, merge %7.3f ms\n", name, split, timer.ms());
+}
+
+int	main(void) {
+	plain	map;
+	counted	other;
+
+	for (int i = 0; i < count; ++i)
+		map.insert(map.end(), ft::make_pair(static_cast<int>((i * 2654435761u) % count), i));
+	for (int i = 0; i < count; ++i)
+		other.insert(other.end(), ft::make_pair(i, i));
+
+	split_join("middle, no counts", map, count / 2);
+	split_join("last 1000, no counts", map, count - 1000);
+	split_join("middle, order_statistics", other, count / 2);
+
+	plain			upper;
+	bench::timer	timer;
+
+	for (plain::iterator it = map.lower_bound(count / 2); it != map.end(); ) {
+		upper.insert(upper.end(), *it);
+		map.erase(it++);
+	}
+	std::printf("%-36s %9.3f ms\n", "middle, copy out + erase", timer.ms());
+	bench::keep(upper.size());
+	return 0;
+}
@@ -0,0 +1,39 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_range_append.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:49:27 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 02:49:27 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Growth of ft::vector under repeated range inserts: insert(end(), first, last) of 8 ints at a time,
+   up to 10K, 100K and 1M elements. The first argument lowers the largest size.
+   For the "before" column, build against the tree before [user-008] with -DBASELINE. That tree
+   grows by exactly the range each time, so its 1M run takes tens of seconds. */
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+int	main(int argc, char** argv) {
+	const int	range[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	const long	largest = argc > 1 ? std::atol(argv[1]) : 1000000;
+
+	for (long total = 10000; total <= largest; total *= 10) {
+		ft::vector<int>	vector;
+		bench::timer	timer;
+
+		for (long i = 0; i < total / 8; ++i)
+			vector.insert(vector.end(), range, range + 8);
+		double	elapsed = timer.ms();
+		std::printf("%8ld elements: %9.2f ms  %8.2f ns/elem\n", total, elapsed, elapsed * 1e6 / total);
+		bench::keep(vector);
+	}
+	return 0;
+}
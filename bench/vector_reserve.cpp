@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_reserve.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:26:09 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 02:26:09 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Element relocation in ft::vector: one reserve(2 * capacity) of 1M elements, and 1M push_back
+   from empty, best of 5, for int, a 32-byte POD and 32-char std::string.
+   For the "before" column, build against the tree before [user-006] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+#include <cstdio>
+#include <string>
+
+struct pod32 {
+	long	fields[4];
+};
+
+static int			make(int i, int*) { return i; }
+static pod32		make(int i, pod32*) { pod32 pod = { { i, i, i, i } }; return pod; }
+static std::string	make(int i, std::string*) { return std::string(32, 'a' + i % 26); }
+
+template <typename T>
+void	run(const char* name) {
+	const int		count = 1000000;
+	const int		runs = 5;
+	ft::vector<T>	source;
+
+	for (int i = 0; i < count; ++i)
+		source.push_back(make(i, static_cast<T*>(0)));
+
+	double	reserve = 0;
+	for (int i = 0; i < runs; ++i) {
+		ft::vector<T>	vector(source);
+		bench::timer	timer;
+
+		vector.reserve(vector.capacity() * 2);
+		double	elapsed = timer.ms();
+		if (i == 0 || elapsed < reserve)
+			reserve = elapsed;
+	}
+	double	push_back = bench::best_of(runs, [&] {
+		ft::vector<T>	vector;
+
+		for (int i = 0; i < count; ++i)
+			vector.push_back(source[i]);
+		bench::keep(vector);
+	});
+	std::printf("%-7s reserve(2 * capacity): %7.2f ms   1M push_back: %7.2f ms\n", name, reserve, push_back);
+}
+
+int	main(void) {
+	run<int>("int");
+	run<pod32>("pod32");
+	run<std::string>("string");
+	return 0;
+}
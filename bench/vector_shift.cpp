@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_shift.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 02:38:44 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/18 02:38:44 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+/* Element shifting in ft::vector: random single and range erases, then random single and
+   fill inserts, on a 200K-element vector<uint64_t>. The positions come from a fixed seed.
+   For the "before" column, build against the tree before [user-007] with -DBASELINE. */
+
+#include "bench.hpp"
+#include "vector.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <stdint.h>
+
+int	main(void) {
+	const int				count = 200000;
+	ft::vector<uint64_t>	vector;
+	bench::timer			timer;
+
+	for (int i = 0; i < count; ++i)
+		vector.push_back(i);
+	std::srand(3);
+
+	timer.restart();
+	for (int i = 0; i < 20000; ++i)
+		vector.erase(vector.begin() + std::rand() % vector.size());
+	std::printf("20000 x erase(pos)              %7.1f ms\n", timer.ms());
+
+	timer.restart();
+	for (int i = 0; i < 2000; ++i) {
+		std::size_t	position = std::rand() % (vector.size() - 10);
+
+		vector.erase(vector.begin() + position, vector.begin() + position + 10);
+	}
+	std::printf("2000 x erase(10-element range)  %7.1f ms\n", timer.ms());
+
+	timer.restart();
+	for (int i = 0; i < 20000; ++i)
+		vector.insert(vector.begin() + std::rand() % vector.size(), static_cast<uint64_t>(i));
+	std::printf("20000 x insert(pos, val)        %7.1f ms\n", timer.ms());
+
+	timer.restart();
+	for (int i = 0; i < 2000; ++i)
+		vector.insert(vector.begin() + std::rand() % vector.size(), 8, static_cast<uint64_t>(i));
+	std::printf("2000 x insert(pos, 8, val)      %7.1f ms\n", timer.ms());
+
+	bench::keep(vector[vector.size() / 2]);
+	return 0;
+}
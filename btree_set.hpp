@@ -0,0 +1,477 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_set.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:03:40 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 23:03:40 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_SET_H
+# define BTREE_SET_H
+
+# include "Additional/less.hpp"
+# include "Additional/equal.hpp"
+# include "Additional/identity.hpp"
+# include "Additional/is_transparent.hpp"
+# include "Additional/btree.hpp"
+# include "Additional/sorted_unique.hpp"
+# include "Additional/lexicographical_compare.hpp"
+
+namespace ft
+{
+
+
+/* ft::set's interface on top of a B-tree, see Additional/btree.hpp. Inserting and erasing invalidate every iterator */
+
+template <typename T, typename Compare = ft::less<T>, typename Allocator = std::allocator<T>, std::size_t NodeBytes = 256>
+class btree_set {
+
+public:
+	/* MEMBER TYPES */
+
+	typedef	T																		key_type;
+	typedef	T																		value_type;
+	typedef	Compare																	key_compare;
+	typedef	Compare																	value_compare;
+
+private:
+	typedef typename ft::btree<value_type, ft::identity<value_type>, key_compare, Allocator, NodeBytes>		tree_type;
+	
+public:
+	typedef typename tree_type::pointer 											pointer;
+	typedef typename tree_type::const_pointer										const_pointer;
+	typedef typename tree_type::reference											reference;
+	typedef typename tree_type::const_reference										const_reference;
+	typedef typename tree_type::iterator											iterator;
+	typedef typename tree_type::const_iterator										const_iterator;
+	typedef typename tree_type::reverse_iterator									reverse_iterator;
+	typedef typename tree_type::const_reverse_iterator								const_reverse_iterator;
+	typedef Allocator																allocator_type;
+	typedef	std::ptrdiff_t															difference_type;
+	typedef	std::size_t																size_type;
+
+	/* ASSIGNMENT */
+
+	explicit btree_set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
+	template <class InputIterator>
+	btree_set(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
+	template <class InputIterator>
+	btree_set(ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
+	btree_set(const btree_set& other);
+	~btree_set();
+
+	btree_set& operator = (const btree_set& other);
+
+	/* ITERATORS */
+
+	iterator							begin();
+	iterator							end();
+	const_iterator						begin() const;
+	const_iterator						end() const;
+	reverse_iterator					rbegin();
+	reverse_iterator					rend();
+	const_reverse_iterator				rbegin() const;
+	const_reverse_iterator				rend() const;
+
+	/* CAPACITY */
+
+	bool								empty() const;
+	size_type							size(void) const;
+	size_type							max_size(void) const;
+
+	/* MODIFIERS */
+
+	template <class InputIterator>
+	void								insert(InputIterator first, InputIterator last);
+	pair<iterator,bool>					insert(const value_type& val);
+	iterator							insert(iterator position, const value_type& val);
+	void								erase(iterator position);
+	size_type							erase(const key_type& k);
+    void								erase(iterator first, iterator last);
+	void								swap(btree_set& x);
+	void								clear(void);
+
+	/* COMPARISON OBJECTS */
+
+	key_compare							key_comp() const;
+	value_compare						value_comp() const;
+
+	/* ELEMENT ACCESS */
+
+	iterator							find(const key_type& k);
+	const_iterator						find(const key_type& k) const;
+	size_type							count(const key_type& k) const;
+	iterator							lower_bound(const key_type& k);
+	const_iterator						lower_bound(const key_type& k) const;
+	iterator							upper_bound(const key_type& k);
+	const_iterator 						upper_bound(const key_type& k) const;
+	pair<const_iterator,const_iterator>	equal_range(const key_type& k) const;
+	pair<iterator,iterator>				equal_range(const key_type& k);
+
+	/* HETEROGENEOUS LOOKUP: only available when key_compare declares is_transparent */
+
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									find(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							find(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, size_type>::type									count(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									lower_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							lower_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									upper_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							upper_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<iterator,iterator> >::type					equal_range(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<const_iterator,const_iterator> >::type		equal_range(const K& k) const;
+
+	/* ALLOCATOR */
+
+	allocator_type						get_allocator() const;
+
+	private:
+		tree_type				_tree;
+};
+
+/* CONSTRUCTORS AND DESTRUCTOR START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree_set<T, Compare, Allocator, NodeBytes>::btree_set (const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) { }
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <class InputIterator>
+btree_set<T, Compare, Allocator, NodeBytes>::btree_set(InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
+	_tree.insert_range(first, last);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <class InputIterator>
+btree_set<T, Compare, Allocator, NodeBytes>::btree_set(ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
+	_tree.insert_sorted(first, last);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree_set<T, Compare, Allocator, NodeBytes>::btree_set(const btree_set& other) : _tree(other._tree) { }
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree_set<T, Compare, Allocator, NodeBytes>::~btree_set() { }
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+btree_set<T, Compare, Allocator, NodeBytes>& btree_set<T, Compare, Allocator, NodeBytes>::operator = (const btree_set& other) {
+	_tree = other._tree;
+	return *this;
+}
+
+/* <-- CONSTRUCTORS AND DESTRUCTOR END */
+
+/* ITERATORS START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::iterator btree_set<T, Compare, Allocator, NodeBytes>::begin() {
+	return _tree.begin();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::iterator btree_set<T, Compare, Allocator, NodeBytes>::end() {
+	return _tree.end();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator btree_set<T, Compare, Allocator, NodeBytes>::begin() const {
+	return _tree.begin();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator btree_set<T, Compare, Allocator, NodeBytes>::end() const {
+	return _tree.end();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::reverse_iterator btree_set<T, Compare, Allocator, NodeBytes>::rbegin() {
+	return _tree.rbegin();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::reverse_iterator btree_set<T, Compare, Allocator, NodeBytes>::rend() {
+	return _tree.rend();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::const_reverse_iterator btree_set<T, Compare, Allocator, NodeBytes>::rbegin() const {
+	return _tree.rbegin();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::const_reverse_iterator btree_set<T, Compare, Allocator, NodeBytes>::rend() const {
+	return _tree.rend();
+}
+
+/* <-- ITERATORS END */
+
+/* CAPACITY START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+bool btree_set<T, Compare, Allocator, NodeBytes>::empty() const {
+	return size() ? false : true;
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::size_type btree_set<T, Compare, Allocator, NodeBytes>::size(void) const {
+	return _tree.size();
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::size_type btree_set<T, Compare, Allocator, NodeBytes>::max_size(void) const {
+	return _tree._alloc.max_size() > __LONG_LONG_MAX__ ? __LONG_LONG_MAX__ : _tree._alloc.max_size();
+}
+
+/* <-- CAPACITY END */
+
+/* MODIFIERS START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <class InputIterator>
+void btree_set<T, Compare, Allocator, NodeBytes>::insert(InputIterator first, InputIterator last) {
+	_tree.insert_range(first, last);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+ft::pair<typename btree_set<T, Compare, Allocator, NodeBytes>::iterator, bool> btree_set<T, Compare, Allocator, NodeBytes>::insert(const value_type& val) {
+	return _tree.insert_unique(val);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::iterator btree_set<T, Compare, Allocator, NodeBytes>::insert(iterator position, const value_type& val) {
+	return _tree.insert(position, val).first;
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree_set<T, Compare, Allocator, NodeBytes>::erase(iterator position) {
+	_tree.erase(position);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::size_type btree_set<T, Compare, Allocator, NodeBytes>::erase(const key_type& k) {
+	iterator	it = find(k);
+
+	if (it != end()) {
+		_tree.erase(it);
+		return 1;
+	}
+	return 0;
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree_set<T, Compare, Allocator, NodeBytes>::erase(iterator first, iterator last) {
+	size_type	arr_size = std::distance(first, last);
+	key_type*	array = new key_type [arr_size];
+
+	for (size_type i = 0; first != last; ++first, ++i) {
+		array[i] = *first;
+	}
+	for (size_type i = 0; i < arr_size; ++i) {
+		erase(array[i]);
+	}
+	delete [] array;
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree_set<T, Compare, Allocator, NodeBytes>::swap(btree_set& x) {
+	tree_type	buf = x._tree;
+
+	x._tree = _tree;
+	_tree = buf;
+}
+
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+void btree_set<T, Compare, Allocator, NodeBytes>::clear(void) {
+	_tree.clear();
+}
+
+/* <-- MODIFIERS END */
+
+/* COMPARISON OBJECTS START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::key_compare btree_set<T, Compare, Allocator, NodeBytes>::key_comp(void) const {
+	return _tree._compare;
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::value_compare btree_set<T, Compare, Allocator, NodeBytes>::value_comp(void) const {
+	return _tree._compare;
+}
+
+/* <-- COMPARISON OBJECTS END */
+
+/* ELEMENT ACCESS START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::iterator btree_set<T, Compare, Allocator, NodeBytes>::find(const key_type& k) {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator btree_set<T, Compare, Allocator, NodeBytes>::find(const key_type& k) const {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::size_type btree_set<T, Compare, Allocator, NodeBytes>::count(const key_type& k) const {
+	return (_tree.find(k) == end() ? 0 : 1);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::iterator btree_set<T, Compare, Allocator, NodeBytes>::lower_bound(const key_type& k) {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator btree_set<T, Compare, Allocator, NodeBytes>::lower_bound(const key_type& k) const {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::iterator btree_set<T, Compare, Allocator, NodeBytes>::upper_bound(const key_type& k) {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator btree_set<T, Compare, Allocator, NodeBytes>::upper_bound(const key_type& k) const {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+ft::pair<typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator, typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator> btree_set<T, Compare, Allocator, NodeBytes>::equal_range(const key_type& k) const {
+	return ft::make_pair(lower_bound(k), upper_bound(k));
+};
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+ft::pair<typename btree_set<T, Compare, Allocator, NodeBytes>::iterator, typename btree_set<T, Compare, Allocator, NodeBytes>::iterator> btree_set<T, Compare, Allocator, NodeBytes>::equal_range(const key_type& k) {
+	return ft::make_pair(lower_bound(k), upper_bound(k));
+}
+
+/* <-- ELEMENT ACCESS END */
+
+/* HETEROGENEOUS LOOKUP START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename btree_set<T, Compare, Allocator, NodeBytes>::iterator>::type btree_set<T, Compare, Allocator, NodeBytes>::find(const K& k) {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator>::type btree_set<T, Compare, Allocator, NodeBytes>::find(const K& k) const {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename btree_set<T, Compare, Allocator, NodeBytes>::size_type>::type btree_set<T, Compare, Allocator, NodeBytes>::count(const K& k) const {
+	return (_tree.find(k) == end() ? 0 : 1);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename btree_set<T, Compare, Allocator, NodeBytes>::iterator>::type btree_set<T, Compare, Allocator, NodeBytes>::lower_bound(const K& k) {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator>::type btree_set<T, Compare, Allocator, NodeBytes>::lower_bound(const K& k) const {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename btree_set<T, Compare, Allocator, NodeBytes>::iterator>::type btree_set<T, Compare, Allocator, NodeBytes>::upper_bound(const K& k) {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator>::type btree_set<T, Compare, Allocator, NodeBytes>::upper_bound(const K& k) const {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename btree_set<T, Compare, Allocator, NodeBytes>::iterator, typename btree_set<T, Compare, Allocator, NodeBytes>::iterator> >::type btree_set<T, Compare, Allocator, NodeBytes>::equal_range(const K& k) {
+	return ft::make_pair(lower_bound(k), upper_bound(k));
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator, typename btree_set<T, Compare, Allocator, NodeBytes>::const_iterator> >::type btree_set<T, Compare, Allocator, NodeBytes>::equal_range(const K& k) const {
+	return ft::make_pair(lower_bound(k), upper_bound(k));
+}
+
+/* <-- HETEROGENEOUS LOOKUP END */
+
+/* ALLOCATOR START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+typename btree_set<T, Compare, Allocator, NodeBytes>::allocator_type btree_set<T, Compare, Allocator, NodeBytes>::get_allocator() const {
+	return allocator_type(_tree._alloc);
+}
+
+/* <-- ALLOCATOR END */
+
+/* NON-MEMBER FUNCTION OVERLOADS START --> */
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+bool operator	==	(const btree_set<T, Compare, Allocator, NodeBytes>& lhs, const btree_set<T, Compare, Allocator, NodeBytes>& rhs) {
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+bool operator	!=	(const btree_set<T, Compare, Allocator, NodeBytes>& lhs, const btree_set<T, Compare, Allocator, NodeBytes>& rhs) {
+	return !(lhs == rhs);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+bool operator	<	(const btree_set<T, Compare, Allocator, NodeBytes>& lhs, const btree_set<T, Compare, Allocator, NodeBytes>& rhs) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+bool operator	<=	(const btree_set<T, Compare, Allocator, NodeBytes>& lhs, const btree_set<T, Compare, Allocator, NodeBytes>& rhs) {
+	return !(rhs < lhs);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+bool operator	>	(const btree_set<T, Compare, Allocator, NodeBytes>& lhs, const btree_set<T, Compare, Allocator, NodeBytes>& rhs) {
+	return (rhs < lhs);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+bool operator	>=	(const btree_set<T, Compare, Allocator, NodeBytes>& lhs, const btree_set<T, Compare, Allocator, NodeBytes>& rhs) {
+	return !(lhs < rhs);
+}
+
+template <typename T, typename Compare, typename Allocator, std::size_t NodeBytes>
+void swap(btree_set<T, Compare, Allocator, NodeBytes>& lhs, btree_set<T, Compare, Allocator, NodeBytes>& rhs) {
+	lhs.swap(rhs);
+}
+
+/* <-- NON-MEMBER FUNCTION OVERLOADS END */
+
+
+} /* FT NAMESPACE */
+
+
+#endif /* BTREE_SET_H */
\ No newline at end of file
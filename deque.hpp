@@ -14,8 +14,10 @@
 # define DEQUE_H
 
 # include <memory>
+# include <cstring>
 # include "Additional/equal.hpp"
 # include "Additional/is_integral.hpp"
+# include "Additional/is_trivially_copyable.hpp"
 # include "Additional/lexicographical_compare.hpp"
 # include "Additional/reverse_iterator.hpp"
 
@@ -23,7 +25,7 @@ namespace ft
 {
 
 
-template <typename T, typename Allocator = std::allocator<T> >
+template <typename T, typename Allocator = std::allocator<T>, std::size_t BlockBytes = 512>
 class deque_node {
 
 public:
@@ -33,131 +35,39 @@ public:
 	typedef const T*				const_pointer;
 	typedef T&						reference;
 	typedef const T&				const_reference;
-	typedef	deque_node<value_type>*	link_type;
+	typedef T**						map_pointer;
 	typedef ptrdiff_t				difference_type;
 
-	deque_node(const allocator_type& alloc = allocator_type());
-	deque_node(const deque_node& other);
-	~deque_node();
+	static pointer	allocate(allocator_type& alloc);
+	static void		deallocate(allocator_type& alloc, pointer block);
 
-	deque_node&	operator = (const deque_node& other);
+	/* Number of elements that fit in a block of BlockBytes bytes, at least one */
 
-	void	init(void);
-
-	void	add_front(const value_type& val);
-	void	add_back(const value_type& val);
-	void	remove_front(void);
-	void	remove_back(void);
-
-	const static difference_type	_capacity = (sizeof (T) <= 1 ? 16 \
-										: sizeof (T) <= 2 ? 8 \
-										: sizeof (T) <= 4 ? 4 \
-										: sizeof (T) <= 8 ? 2 : 1);
-
-	pointer							_left_border;
-	pointer							_left;
-	pointer							_right_border;
-	pointer							_right;
-	link_type						_next;
-	link_type						_prev;
-	allocator_type					_alloc;
+	const static difference_type	_capacity = (sizeof (T) < BlockBytes ? BlockBytes / sizeof (T) : 1);
 };
 
-template <typename T, typename Allocator>
-deque_node<T, Allocator>::deque_node(const allocator_type& alloc) : _left_border(nullptr), _left(nullptr), _right_border(nullptr), _right(nullptr), _next(nullptr), _prev(nullptr), _alloc(alloc) { }
-
-template <typename T, typename Allocator>
-deque_node<T, Allocator>::deque_node(const deque_node& other) : _alloc(other._alloc) {
-	*this = other;
-}
-
-template <typename T, typename Allocator>
-deque_node<T, Allocator>::~deque_node() {
-	if (!_left_border)
-		return ;
-	while (_left <= _right)
-		_alloc.destroy(_left++);
-	_alloc.deallocate(_left_border, _capacity);
-}
-
-template <typename T, typename Allocator>
-deque_node<T, Allocator>& deque_node<T, Allocator>::operator = (const deque_node& other) {
-	if (!other._left_border)
-		return ;
-	_left_border = _alloc.allocate(_capacity);
-	_right_border = _left_border + _capacity - 1;
-	_left = _left_border + (other._left - other._left_border);
-	_right = _left;
-	for (difference_type i = 0; other._left + i != other._right; ++i, ++_right)
-		_alloc.construct(_right, *(other._left + i));
-}
-
-template <typename T, typename Allocator>
-void deque_node<T, Allocator>::init(void) {
-	_left_border = _alloc.allocate(_capacity);
-	_right_border = _left_border + _capacity - 1;
-}
-
-template <typename T, typename Allocator>
-void deque_node<T, Allocator>::add_front(const value_type& val) {
-	if (!_left) {
-		_left = _right_border;
-		_right = _left;
-		_alloc.construct(_left, val);
-	}
-	else {
-		_left--;
-		_alloc.construct(_left, val);
-	}
-}
-
-template <typename T, typename Allocator>
-void deque_node<T, Allocator>::add_back(const value_type& val) {
-	if (!_right) {
-		_right = _left_border;
-		_left = _right;
-		_alloc.construct(_right, val);
-	}
-	else {
-		_right++;
-		_alloc.construct(_right, val);
-	}
-}
-
-template <typename T, typename Allocator>
-void deque_node<T, Allocator>::remove_front(void) {
-	_alloc.destroy(_left);
-	if (_left == _right) {
-		_left = nullptr;
-		_right = nullptr;
-	}
-	else
-		_left++;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque_node<T, Allocator, BlockBytes>::pointer deque_node<T, Allocator, BlockBytes>::allocate(allocator_type& alloc) {
+	return alloc.allocate(_capacity);
 }
 
-template <typename T, typename Allocator>
-void deque_node<T, Allocator>::remove_back(void) {
-	_alloc.destroy(_right);
-	if (_left == _right) {
-		_left = nullptr;
-		_right = nullptr;
-	}
-	else
-		_right--;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque_node<T, Allocator, BlockBytes>::deallocate(allocator_type& alloc, pointer block) {
+	alloc.deallocate(block, _capacity);
 }
 
 
 template <typename T, typename Node>
 class deque_iterator {
 public:
-	typedef	Node*								iterator;
+	typedef	typename Node::map_pointer			map_pointer;
 	typedef	T									value_type;
 	typedef	T*									pointer;
 	typedef	T&									reference;
 	typedef	std::ptrdiff_t						difference_type;
-	typedef	std::bidirectional_iterator_tag		iterator_category;
+	typedef	std::random_access_iterator_tag		iterator_category;
 
-	deque_iterator(const iterator& base = iterator(), const pointer& elem = pointer(), const iterator& null = iterator());
+	deque_iterator(const pointer& elem = pointer(), const map_pointer& node = map_pointer());
 	deque_iterator(const deque_iterator& other);
 	~deque_iterator();
 
@@ -165,6 +75,7 @@ public:
 
 	reference		operator * (void) const;
 	pointer			operator -> (void) const;
+	reference		operator []	(difference_type diff) const;
 
 	deque_iterator	operator ++ (int);
 	deque_iterator&	operator ++ (void);
@@ -174,32 +85,38 @@ public:
 	deque_iterator	operator -	(difference_type diff) const;
 	deque_iterator&	operator +=	(difference_type diff);
 	deque_iterator&	operator -=	(difference_type diff);
-	
-	const iterator&	base(void) const;
-	const pointer&	elem(void) const;
-	const iterator&	null(void) const;
 
-	iterator	_base;
+	const pointer&		elem(void) const;
+	const pointer&		first(void) const;
+	const pointer&		last(void) const;
+	const map_pointer&	node(void) const;
+
+	void				set_node(map_pointer node);
+
 	pointer		_elem;
-	iterator	_null;
+	pointer		_first;
+	pointer		_last;
+	map_pointer	_node;
 };
 
 template <typename T, typename Node>
-deque_iterator<T, Node>::deque_iterator(const iterator& base, const pointer& elem, const iterator& null) : _base(base), _elem(elem), _null(null) { }
+deque_iterator<T, Node>::deque_iterator(const pointer& elem, const map_pointer& node) : _elem(elem), _first(nullptr), _last(nullptr), _node(node) {
+	if (_node)
+		set_node(_node);
+}
 
 template <typename T, typename Node>
-deque_iterator<T, Node>::deque_iterator(const deque_iterator& other) : _base(other.base()), _elem(other.elem()), _null(other.null()) { }
+deque_iterator<T, Node>::deque_iterator(const deque_iterator& other) : _elem(other.elem()), _first(other.first()), _last(other.last()), _node(other.node()) { }
 
 template <typename T, typename Node>
 deque_iterator<T, Node>::~deque_iterator() { }
 
 template <typename T, typename Node>
 deque_iterator<T, Node>& deque_iterator<T, Node>::operator = (const deque_iterator& other) {
-	if (*this != other) {
-		_base = other.base();
-		_elem = other.elem();
-		_null = other.null();
-	}
+	_elem = other.elem();
+	_first = other.first();
+	_last = other.last();
+	_node = other.node();
 	return *this;
 }
 
@@ -213,34 +130,24 @@ typename deque_iterator<T, Node>::pointer deque_iterator<T, Node>::operator -> (
 	return _elem;
 }
 
+template <typename T, typename Node>
+typename deque_iterator<T, Node>::reference deque_iterator<T, Node>::operator [] (difference_type diff) const {
+	return *(*this + diff);
+}
+
 template <typename T, typename Node>
 deque_iterator<T, Node> deque_iterator<T, Node>::operator ++ (int) {
 	deque_iterator	copy(*this);
 
-	if (_elem && _elem != _base->_right)
-		_elem++;
-	else if (_elem && _elem == _base->_right) {
-		_base = _base->_next;
-		_elem = _base->_left;
-	}
-	else {
-		_base = _base->_next;
-		_elem = _base->_left;
-	}
+	++*this;
 	return copy;
 }
 
 template <typename T, typename Node>
 deque_iterator<T, Node>& deque_iterator<T, Node>::operator ++ (void) {
-	if (_elem && _elem != _base->_right)
-		_elem++;
-	else if (_elem && _elem == _base->_right) {
-		_base = _base->_next;
-		_elem = _base->_left;
-	}
-	else {
-		_base = _base->_next;
-		_elem = _base->_left;
+	if (++_elem == _last) {
+		set_node(_node + 1);
+		_elem = _first;
 	}
 	return *this;
 }
@@ -249,151 +156,96 @@ template <typename T, typename Node>
 deque_iterator<T, Node> deque_iterator<T, Node>::operator -- (int) {
 	deque_iterator	copy(*this);
 
-	if (_elem && _elem != _base->_left)
-		_elem--;
-	else if (_elem && _elem == _base->_left) {
-		_base = _base->_prev;
-		_elem = _base->_right;
-	}
-	else {
-		_base = _base->_prev;
-		_elem = _base->_right;
-	}
+	--*this;
 	return copy;
 }
 
 template <typename T, typename Node>
 deque_iterator<T, Node>& deque_iterator<T, Node>::operator -- (void) {
-	if (_elem && _elem != _base->_left)
-		_elem--;
-	else if (_elem && _elem == _base->_left) {
-		_base = _base->_prev;
-		_elem = _base->_right;
-	}
-	else {
-		_base = _base->_prev;
-		_elem = _base->_right;
+	if (_elem == _first) {
+		set_node(_node - 1);
+		_elem = _last;
 	}
+	--_elem;
 	return *this;
 }
 
 template <typename T, typename Node>
 deque_iterator<T, Node> deque_iterator<T, Node>::operator +	(difference_type diff) const {
 	deque_iterator	copy(*this);
-	difference_type	offset = _base->_right - _elem;
 
-	if (offset >= diff)
-		copy._elem = _elem + diff;
-	else {
-		diff -= offset;
-		copy._base = copy._base->_next;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			copy._base = copy._base->_next;
-			if (_base == _null) {
-				copy._elem = nullptr;
-				return copy;
-			}
-		}
-		copy._elem = copy._base->_left + diff - 1;
-	}
-	return copy;
+	return copy += diff;
 }
 
 template <typename T, typename Node>
 deque_iterator<T, Node> deque_iterator<T, Node>::operator -	(difference_type diff) const {
 	deque_iterator	copy(*this);
-	difference_type	offset = _elem - _base->_left;
 
-	if (offset >= diff)
-		copy._elem = _elem - diff;
-	else {
-		diff -= offset;
-		copy._base = copy._base->_prev;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			copy._base = copy._base->_prev;
-			if (_base == _null) {
-				copy._elem = nullptr;
-				return copy;
-			}
-		}
-		copy._elem = copy._base->_right - diff + 1;
-	}
-	return copy;
+	return copy -= diff;
 }
 
 template <typename T, typename Node>
 deque_iterator<T, Node>& deque_iterator<T, Node>::operator +=	(difference_type diff) {
-	difference_type	offset = _base->_right - _elem;
+	difference_type	offset = diff + (_elem - _first);
+
+	/* Stay inside the current block when possible, otherwise jump through the map */
 
-	if (offset >= diff)
-		_elem = _elem + diff;
+	if (offset >= 0 && offset < Node::_capacity)
+		_elem += diff;
 	else {
-		diff -= offset;
-		_base = _base->_next;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			_base = _base->_next;
-			if (_base == _null) {
-				_elem = nullptr;
-				return *this;
-			}
-		}
-		_elem = _base->_left + diff - 1;
+		difference_type	node_offset = offset > 0 ? offset / Node::_capacity
+									: -((-offset - 1) / Node::_capacity) - 1;
+
+		set_node(_node + node_offset);
+		_elem = _first + (offset - node_offset * Node::_capacity);
 	}
 	return *this;
 }
 
 template <typename T, typename Node>
 deque_iterator<T, Node>& deque_iterator<T, Node>::operator -=	(difference_type diff) {
-	difference_type	offset = _elem - _base->_left;
+	return *this += -diff;
+}
 
-	if (offset >= diff)
-		_elem = _elem - diff;
-	else {
-		diff -= offset;
-		_base = _base->_prev;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			_base = _base->_prev;
-			if (_base == _null) {
-				_elem = nullptr;
-				return *this;
-			}
-		}
-		_elem = _base->_right - diff + 1;
-	}
-	return *this;
+template <typename T, typename Node>
+const typename deque_iterator<T, Node>::pointer&	deque_iterator<T, Node>::elem(void) const {
+	return _elem;
 }
 
 template <typename T, typename Node>
-const typename deque_iterator<T, Node>::iterator&	deque_iterator<T, Node>::base(void) const {
-	return _base;
+const typename deque_iterator<T, Node>::pointer&	deque_iterator<T, Node>::first(void) const {
+	return _first;
 }
 
 template <typename T, typename Node>
-const typename deque_iterator<T, Node>::pointer&	deque_iterator<T, Node>::elem(void) const {
-	return _elem;
+const typename deque_iterator<T, Node>::pointer&	deque_iterator<T, Node>::last(void) const {
+	return _last;
 }
 
 template <typename T, typename Node>
-const typename deque_iterator<T, Node>::iterator&	deque_iterator<T, Node>::null(void) const {
-	return _null;
+const typename deque_iterator<T, Node>::map_pointer&	deque_iterator<T, Node>::node(void) const {
+	return _node;
+}
+
+template <typename T, typename Node>
+void deque_iterator<T, Node>::set_node(map_pointer node) {
+	_node = node;
+	_first = *node;
+	_last = _first + Node::_capacity;
 }
 
 
 template <typename T, typename Node>
 class const_deque_iterator {
 public:
-	typedef	Node*								iterator;
+	typedef	typename Node::map_pointer			map_pointer;
 	typedef	T									value_type;
-	typedef	T*									pointer;
-	typedef	T&									reference;
+	typedef	const T*							pointer;
+	typedef	const T&							reference;
 	typedef	std::ptrdiff_t						difference_type;
-	typedef	std::bidirectional_iterator_tag		iterator_category;
+	typedef	std::random_access_iterator_tag		iterator_category;
 
-	const_deque_iterator(const iterator& base = iterator(), const pointer& elem = pointer(), const iterator& null = iterator());
+	const_deque_iterator(const pointer& elem = pointer(), const map_pointer& node = map_pointer());
 	const_deque_iterator(const const_deque_iterator& other);
 	const_deque_iterator(const deque_iterator<T, Node>& other);
 	~const_deque_iterator();
@@ -403,6 +255,7 @@ public:
 
 	reference		operator * (void) const;
 	pointer			operator -> (void) const;
+	reference		operator []	(difference_type diff) const;
 
 	const_deque_iterator	operator ++ (int);
 	const_deque_iterator&	operator ++ (void);
@@ -412,45 +265,50 @@ public:
 	const_deque_iterator	operator -	(difference_type diff) const;
 	const_deque_iterator&	operator +=	(difference_type diff);
 	const_deque_iterator&	operator -=	(difference_type diff);
-	
-	const iterator&	base(void) const;
-	const pointer&	elem(void) const;
-	const iterator&	null(void) const;
 
-	iterator	_base;
+	const pointer&		elem(void) const;
+	const pointer&		first(void) const;
+	const pointer&		last(void) const;
+	const map_pointer&	node(void) const;
+
+	void				set_node(map_pointer node);
+
 	pointer		_elem;
-	iterator	_null;
+	pointer		_first;
+	pointer		_last;
+	map_pointer	_node;
 };
 
 template <typename T, typename Node>
-const_deque_iterator<T, Node>::const_deque_iterator(const iterator& base, const pointer& elem, const iterator& null) : _base(base), _elem(elem), _null(null) { }
+const_deque_iterator<T, Node>::const_deque_iterator(const pointer& elem, const map_pointer& node) : _elem(elem), _first(nullptr), _last(nullptr), _node(node) {
+	if (_node)
+		set_node(_node);
+}
 
 template <typename T, typename Node>
-const_deque_iterator<T, Node>::const_deque_iterator(const const_deque_iterator& other) : _base(other.base()), _elem(other.elem()), _null(other.null()) { }
+const_deque_iterator<T, Node>::const_deque_iterator(const const_deque_iterator& other) : _elem(other.elem()), _first(other.first()), _last(other.last()), _node(other.node()) { }
 
 template <typename T, typename Node>
-const_deque_iterator<T, Node>::const_deque_iterator(const deque_iterator<T, Node>& other) : _base(other.base()), _elem(other.elem()), _null(other.null()) { }
+const_deque_iterator<T, Node>::const_deque_iterator(const deque_iterator<T, Node>& other) : _elem(other.elem()), _first(other.first()), _last(other.last()), _node(other.node()) { }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node>::~const_deque_iterator() { }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node>& const_deque_iterator<T, Node>::operator = (const const_deque_iterator& other) {
-	if (*this != other) {
-		_base = other.base();
-		_elem = other.elem();
-		_null = other.null();
-	}
+	_elem = other.elem();
+	_first = other.first();
+	_last = other.last();
+	_node = other.node();
 	return *this;
 }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node>& const_deque_iterator<T, Node>::operator = (const deque_iterator<T, Node>& other) {
-	if (*this != other) {
-		_base = other.base();
-		_elem = other.elem();
-		_null = other.null();
-	}
+	_elem = other.elem();
+	_first = other.first();
+	_last = other.last();
+	_node = other.node();
 	return *this;
 }
 
@@ -464,34 +322,24 @@ typename const_deque_iterator<T, Node>::pointer const_deque_iterator<T, Node>::o
 	return _elem;
 }
 
+template <typename T, typename Node>
+typename const_deque_iterator<T, Node>::reference const_deque_iterator<T, Node>::operator [] (difference_type diff) const {
+	return *(*this + diff);
+}
+
 template <typename T, typename Node>
 const_deque_iterator<T, Node> const_deque_iterator<T, Node>::operator ++ (int) {
 	const_deque_iterator	copy(*this);
 
-	if (_elem && _elem != _base->_right)
-		_elem++;
-	else if (_elem && _elem == _base->_right) {
-		_base = _base->_next;
-		_elem = _base->_left;
-	}
-	else {
-		_base = _base->_next;
-		_elem = _base->_left;
-	}
+	++*this;
 	return copy;
 }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node>& const_deque_iterator<T, Node>::operator ++ (void) {
-	if (_elem && _elem != _base->_right)
-		_elem++;
-	else if (_elem && _elem == _base->_right) {
-		_base = _base->_next;
-		_elem = _base->_left;
-	}
-	else {
-		_base = _base->_next;
-		_elem = _base->_left;
+	if (++_elem == _last) {
+		set_node(_node + 1);
+		_elem = _first;
 	}
 	return *this;
 }
@@ -500,139 +348,95 @@ template <typename T, typename Node>
 const_deque_iterator<T, Node> const_deque_iterator<T, Node>::operator -- (int) {
 	const_deque_iterator	copy(*this);
 
-	if (_elem && _elem != _base->_left)
-		_elem--;
-	else if (_elem && _elem == _base->_left) {
-		_base = _base->_prev;
-		_elem = _base->_right;
-	}
-	else {
-		_base = _base->_prev;
-		_elem = _base->_right;
-	}
+	--*this;
 	return copy;
 }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node>& const_deque_iterator<T, Node>::operator -- (void) {
-	if (_elem && _elem != _base->_left)
-		_elem--;
-	else if (_elem && _elem == _base->_left) {
-		_base = _base->_prev;
-		_elem = _base->_right;
-	}
-	else {
-		_base = _base->_prev;
-		_elem = _base->_right;
+	if (_elem == _first) {
+		set_node(_node - 1);
+		_elem = _last;
 	}
+	--_elem;
 	return *this;
 }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node> const_deque_iterator<T, Node>::operator +	(difference_type diff) const {
 	const_deque_iterator	copy(*this);
-	difference_type	offset = _base->_right - _elem;
 
-	if (offset >= diff)
-		copy._elem = _elem + diff;
-	else {
-		diff -= offset;
-		copy._base = copy._base->_next;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			copy._base = copy._base->_next;
-			if (_base == _null) {
-				copy._elem = nullptr;
-				return copy;
-			}
-		}
-		copy._elem = copy._base->_left + diff - 1;
-	}
-	return copy;
+	return copy += diff;
 }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node> const_deque_iterator<T, Node>::operator -	(difference_type diff) const {
 	const_deque_iterator	copy(*this);
-	difference_type	offset = _elem - _base->_left;
 
-	if (offset >= diff)
-		copy._elem = _elem - diff;
-	else {
-		diff -= offset;
-		copy._base = copy._base->_prev;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			copy._base = copy._base->_prev;
-			if (_base == _null) {
-				copy._elem = nullptr;
-				return copy;
-			}
-		}
-		copy._elem = copy._base->_right - diff + 1;
-	}
-	return copy;
+	return copy -= diff;
 }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node>& const_deque_iterator<T, Node>::operator +=	(difference_type diff) {
-	difference_type	offset = _base->_right - _elem;
+	difference_type	offset = diff + (_elem - _first);
 
-	if (offset >= diff)
-		_elem = _elem + diff;
+	if (offset >= 0 && offset < Node::_capacity)
+		_elem += diff;
 	else {
-		diff -= offset;
-		_base = _base->_next;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			_base = _base->_next;
-			if (_base == _null) {
-				_elem = nullptr;
-				return *this;
-			}
-		}
-		_elem = _base->_left + diff - 1;
+		difference_type	node_offset = offset > 0 ? offset / Node::_capacity
+									: -((-offset - 1) / Node::_capacity) - 1;
+
+		set_node(_node + node_offset);
+		_elem = _first + (offset - node_offset * Node::_capacity);
 	}
 	return *this;
 }
 
 template <typename T, typename Node>
 const_deque_iterator<T, Node>& const_deque_iterator<T, Node>::operator -=	(difference_type diff) {
-	difference_type	offset = _elem - _base->_left;
+	return *this += -diff;
+}
 
-	if (offset >= diff)
-		_elem = _elem - diff;
-	else {
-		diff -= offset;
-		_base = _base->_prev;
-		while (diff > _base->_capacity) {
-			diff -= _base->_capacity;
-			_base = _base->_prev;
-			if (_base == _null) {
-				_elem = nullptr;
-				return *this;
-			}
-		}
-		_elem = _base->_right - diff + 1;
-	}
-	return *this;
+template <typename T, typename Node>
+const typename const_deque_iterator<T, Node>::pointer&	const_deque_iterator<T, Node>::elem(void) const {
+	return _elem;
 }
 
 template <typename T, typename Node>
-const typename const_deque_iterator<T, Node>::iterator&	const_deque_iterator<T, Node>::base(void) const {
-	return _base;
+const typename const_deque_iterator<T, Node>::pointer&	const_deque_iterator<T, Node>::first(void) const {
+	return _first;
 }
 
 template <typename T, typename Node>
-const typename const_deque_iterator<T, Node>::pointer&	const_deque_iterator<T, Node>::elem(void) const {
-	return _elem;
+const typename const_deque_iterator<T, Node>::pointer&	const_deque_iterator<T, Node>::last(void) const {
+	return _last;
 }
 
 template <typename T, typename Node>
-const typename const_deque_iterator<T, Node>::iterator&	const_deque_iterator<T, Node>::null(void) const {
-	return _null;
+const typename const_deque_iterator<T, Node>::map_pointer&	const_deque_iterator<T, Node>::node(void) const {
+	return _node;
+}
+
+template <typename T, typename Node>
+void const_deque_iterator<T, Node>::set_node(map_pointer node) {
+	_node = node;
+	_first = *node;
+	_last = _first + Node::_capacity;
+}
+
+
+/* NON-MEMBER OPERATORS */
+
+template <typename _IterL, typename _IterR>
+bool __deque_iterator_less(const _IterL& lhs, const _IterR& rhs) {
+	return lhs.node() == rhs.node() ? lhs.elem() < rhs.elem() : lhs.node() < rhs.node();
 }
 
+template <typename _Node, typename _IterL, typename _IterR>
+std::ptrdiff_t __deque_iterator_distance(const _IterL& lhs, const _IterR& rhs) {
+	return _Node::_capacity * (lhs.node() - rhs.node() - (lhs.node() ? 1 : 0))
+		+ (lhs.elem() - lhs.first()) + (rhs.last() - rhs.elem());
+}
 
 template <typename _T, typename _Node>
 bool operator == (const deque_iterator<_T, _Node>& lhs, const deque_iterator<_T, _Node>& rhs) {
@@ -674,16 +478,89 @@ bool operator != (const deque_iterator<_T, _Node>& lhs, const const_deque_iterat
 	return !(lhs.elem() == rhs.elem());
 }
 
+template <typename _T, typename _Node>
+bool operator < (const deque_iterator<_T, _Node>& lhs, const deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_less(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+bool operator <= (const deque_iterator<_T, _Node>& lhs, const deque_iterator<_T, _Node>& rhs) {
+	return !__deque_iterator_less(rhs, lhs);
+}
+
+template <typename _T, typename _Node>
+bool operator > (const deque_iterator<_T, _Node>& lhs, const deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_less(rhs, lhs);
+}
+
+template <typename _T, typename _Node>
+bool operator >= (const deque_iterator<_T, _Node>& lhs, const deque_iterator<_T, _Node>& rhs) {
+	return !__deque_iterator_less(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+bool operator < (const const_deque_iterator<_T, _Node>& lhs, const const_deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_less(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+bool operator <= (const const_deque_iterator<_T, _Node>& lhs, const const_deque_iterator<_T, _Node>& rhs) {
+	return !__deque_iterator_less(rhs, lhs);
+}
+
+template <typename _T, typename _Node>
+bool operator > (const const_deque_iterator<_T, _Node>& lhs, const const_deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_less(rhs, lhs);
+}
+
+template <typename _T, typename _Node>
+bool operator >= (const const_deque_iterator<_T, _Node>& lhs, const const_deque_iterator<_T, _Node>& rhs) {
+	return !__deque_iterator_less(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+typename deque_iterator<_T, _Node>::difference_type operator - (const deque_iterator<_T, _Node>& lhs, const deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_distance<_Node>(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+typename const_deque_iterator<_T, _Node>::difference_type operator - (const const_deque_iterator<_T, _Node>& lhs, const const_deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_distance<_Node>(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+typename const_deque_iterator<_T, _Node>::difference_type operator - (const const_deque_iterator<_T, _Node>& lhs, const deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_distance<_Node>(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+typename deque_iterator<_T, _Node>::difference_type operator - (const deque_iterator<_T, _Node>& lhs, const const_deque_iterator<_T, _Node>& rhs) {
+	return __deque_iterator_distance<_Node>(lhs, rhs);
+}
+
+template <typename _T, typename _Node>
+deque_iterator<_T, _Node> operator + (typename deque_iterator<_T, _Node>::difference_type n, const deque_iterator<_T, _Node>& it) {
+	return it + n;
+}
+
+template <typename _T, typename _Node>
+const_deque_iterator<_T, _Node> operator + (typename const_deque_iterator<_T, _Node>::difference_type n, const const_deque_iterator<_T, _Node>& it) {
+	return it + n;
+}
+
 
-template <typename T, typename Allocator = std::allocator<T> >
+template <typename T, typename Allocator = std::allocator<T>, std::size_t BlockBytes = 512>
 class deque {
 
 public:
 	typedef T														value_type;
+	typedef Allocator												allocator_type;
 
 private:
-	typedef deque_node<value_type>									node_type;
-	typedef deque_node<value_type>*									link_type;
+	typedef deque_node<value_type, allocator_type, BlockBytes>		node_type;
+	typedef typename node_type::map_pointer							map_pointer;
+	typedef typename Allocator::template rebind<T*>::other			map_allocator_type;
+	typedef typename ft::is_trivially_copyable<T>::type				trivial_type;
 
 public:
 	typedef typename node_type::pointer								pointer;
@@ -692,7 +569,6 @@ public:
 	typedef typename node_type::const_reference						const_reference;
 	typedef	size_t													size_type;
 	typedef	ptrdiff_t												difference_type;
-	typedef typename Allocator::template rebind<node_type>::other	allocator_type;
 	typedef deque_iterator<value_type, node_type>					iterator;
 	typedef const_deque_iterator<value_type, node_type>				const_iterator;
 	typedef ft::reverse_iterator<iterator>							reverse_iterator;
@@ -759,443 +635,1023 @@ private:
 	template <typename _Integer>
 	void						__insert(iterator position, _Integer n, const _Integer& val, ft::true_type);
 
-	void						_node_push_back(void);
-	void						_node_push_front(void);
+	template <typename InputIterator>
+	void						__assign_range(InputIterator first, InputIterator last, std::input_iterator_tag);
+	template <typename ForwardIterator>
+	void						__assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+	template <typename InputIterator>
+	void						__insert_range(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag);
+	template <typename ForwardIterator>
+	void						__insert_range(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
+
+	void						_insert_aux(iterator position, size_type n, const value_type& val);
+	template <typename ForwardIterator>
+	void						_insert_aux(iterator position, ForwardIterator first, ForwardIterator last, size_type n);
+
+	iterator					_reserve_elements_at_back(size_type n);
+	iterator					_reserve_elements_at_front(size_type n);
+	void						_erase_at_begin(iterator position);
+	void						_erase_at_end(iterator position);
+
+	/* Block-wise fill and copy: every block is filled with a tight loop, or a memcpy for trivially copyable types */
+
+	void						_fill(iterator first, iterator last, const value_type& val);
+	iterator					_copy(iterator first, iterator last, iterator dest);
+	iterator					_copy_backward(iterator first, iterator last, iterator dest_last);
+	void						_uninitialized_fill(iterator first, iterator last, const value_type& val);
+	template <typename _Iterator>
+	_Iterator					_uninitialized_copy(_Iterator src, iterator first, iterator last);
+
+	template <typename _Iterator>
+	_Iterator					__copy_to_block(_Iterator src, pointer first, pointer last);
+	const_iterator				__copy_to_block(const_iterator src, pointer first, pointer last);
+	const_pointer				__copy_to_block(const_pointer src, pointer first, pointer last);
+	pointer						__copy_to_block(pointer src, pointer first, pointer last);
+	void						__copy_block(const_pointer src, pointer first, pointer last, ft::true_type);
+	void						__copy_block(const_pointer src, pointer first, pointer last, ft::false_type);
+	void						__move_block(pointer first, pointer last, pointer dest, ft::true_type);
+	void						__move_block(pointer first, pointer last, pointer dest, ft::false_type);
+	void						__move_block_backward(pointer first, pointer last, pointer dest_last, ft::true_type);
+	void						__move_block_backward(pointer first, pointer last, pointer dest_last, ft::false_type);
+	void						__fill_block(pointer first, pointer last, const value_type& val, ft::true_type);
+	void						__fill_block(pointer first, pointer last, const value_type& val, ft::false_type);
+
+	void						_initialize_map(size_type n);
+	void						_reallocate_map(size_type nodes_to_add, bool add_at_front);
+	void						_reserve_map_at_back(size_type nodes_to_add = 1);
+	void						_reserve_map_at_front(size_type nodes_to_add = 1);
+
+	void						_node_push_back(const value_type& val);
+	void						_node_push_front(const value_type& val);
 	void						_node_pop_back(void);
 	void						_node_pop_front(void);
 
-	size_type			_size;
-	link_type			_null;
-	allocator_type		_node_alloc;
+	pointer						_allocate_node(void);
+	void						_deallocate_node(pointer block);
+	void						_release_spare_nodes(void);
+
+	/* Freed blocks are kept here and reused before asking the allocator for a new one */
+
+	const static size_type		_spare_capacity = 4;
+
+	map_pointer			_map;
+	size_type			_map_size;
+	iterator			_start;
+	iterator			_finish;
+	allocator_type		_alloc;
+	map_allocator_type	_map_alloc;
+	pointer				_spare_nodes[_spare_capacity];
+	size_type			_spare_size;
 };
 
-template <typename T, typename Allocator>
-deque<T, Allocator>::deque(const allocator_type& alloc) : _size(0), _node_alloc(alloc) {
-	_null = _node_alloc.allocate(1);
-	_node_alloc.construct(_null);
-	_null->_next = _null;
-	_null->_prev = _null;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+deque<T, Allocator, BlockBytes>::deque(const allocator_type& alloc) : _map(nullptr), _map_size(0), _alloc(alloc), _map_alloc(alloc), _spare_nodes(), _spare_size(0) {
+	_initialize_map(0);
 }
 
-template <typename T, typename Allocator>
-deque<T, Allocator>::deque(size_type n, const value_type& val, const allocator_type& alloc) : _node_alloc(alloc) {
-	_null = _node_alloc.allocate(1);
-	_node_alloc.construct(_null);
-	_null->_next = _null;
-	_null->_prev = _null;
-	assign(n, val);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+deque<T, Allocator, BlockBytes>::deque(size_type n, const value_type& val, const allocator_type& alloc) : _map(nullptr), _map_size(0), _alloc(alloc), _map_alloc(alloc), _spare_nodes(), _spare_size(0) {
+	_initialize_map(n);
+	_uninitialized_fill(_start, _finish, val);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, std::size_t BlockBytes>
 template <class InputIterator>
-deque<T, Allocator>::deque(InputIterator first, InputIterator last, const allocator_type& alloc) : _node_alloc(alloc) {
-	_null = _node_alloc.allocate(1);
-	_node_alloc.construct(_null);
-	_null->_next = _null;
-	_null->_prev = _null;
-
+deque<T, Allocator, BlockBytes>::deque(InputIterator first, InputIterator last, const allocator_type& alloc) : _map(nullptr), _map_size(0), _alloc(alloc), _map_alloc(alloc), _spare_nodes(), _spare_size(0) {
 	typedef typename ft::is_integral<InputIterator>::type	_Type;
+
+	_initialize_map(0);
 	__assign(first, last, _Type());
 }
 
-template <typename T, typename Allocator>
-deque<T, Allocator>::deque(const deque& x) {
-	_null = _node_alloc.allocate(1);
-	_node_alloc.construct(_null);
-	_null->_next = _null;
-	_null->_prev = _null;
-	__assign(x.begin(), x.end(), ft::false_type());
+template <typename T, typename Allocator, std::size_t BlockBytes>
+deque<T, Allocator, BlockBytes>::deque(const deque& x) : _map(nullptr), _map_size(0), _alloc(x._alloc), _map_alloc(x._map_alloc), _spare_nodes(), _spare_size(0) {
+	_initialize_map(x.size());
+	_uninitialized_copy(x.begin(), _start, _finish);
 }
 
-template <typename T, typename Allocator>
-deque<T, Allocator>::~deque() {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+deque<T, Allocator, BlockBytes>::~deque() {
 	clear();
-	_node_alloc.destroy(_null);
-	_node_alloc.deallocate(_null, 1);
+	node_type::deallocate(_alloc, _start._first);
+	_release_spare_nodes();
+	_map_alloc.deallocate(_map, _map_size);
 }
 
-template <typename T, typename Allocator>
-deque<T, Allocator>& deque<T, Allocator>::operator = (const deque& x) {
-	__assign(x.begin(), x.end(), ft::false_type());
+template <typename T, typename Allocator, std::size_t BlockBytes>
+deque<T, Allocator, BlockBytes>& deque<T, Allocator, BlockBytes>::operator = (const deque& x) {
+	if (this != &x)
+		__assign(x.begin(), x.end(), ft::false_type());
 	return *this;
 }
 
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::iterator deque<T, Allocator>::begin() {
-	return iterator(_null->_next, _null->_next->_left, _null);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::begin() {
+	return _start;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_iterator deque<T, Allocator>::begin() const {
-	return const_iterator(_null->_next, _null->_next->_left, _null);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_iterator deque<T, Allocator, BlockBytes>::begin() const {
+	return _start;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::iterator deque<T, Allocator>::end() {
-	return iterator(_null, nullptr, _null);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::end() {
+	return _finish;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_iterator deque<T, Allocator>::end() const {
-	return const_iterator(_null, nullptr, _null);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_iterator deque<T, Allocator, BlockBytes>::end() const {
+	return _finish;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::reverse_iterator deque<T, Allocator>::rbegin() {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::reverse_iterator deque<T, Allocator, BlockBytes>::rbegin() {
 	return reverse_iterator(end());
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::rbegin() const {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_reverse_iterator deque<T, Allocator, BlockBytes>::rbegin() const {
 	return const_reverse_iterator(end());
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::reverse_iterator deque<T, Allocator>::rend() {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::reverse_iterator deque<T, Allocator, BlockBytes>::rend() {
 	return reverse_iterator(begin());
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_reverse_iterator deque<T, Allocator>::rend() const {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_reverse_iterator deque<T, Allocator, BlockBytes>::rend() const {
 	return const_reverse_iterator(begin());
 }
 
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::size_type deque<T, Allocator>::size() const {
-	return _size;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::size_type deque<T, Allocator, BlockBytes>::size() const {
+	return _finish - _start;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::size_type deque<T, Allocator>::max_size() const {
-	return _node_alloc.max_size() > __LONG_LONG_MAX__ ? __LONG_LONG_MAX__ : _node_alloc.max_size();
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::size_type deque<T, Allocator, BlockBytes>::max_size() const {
+	return _alloc.max_size() > __LONG_LONG_MAX__ ? __LONG_LONG_MAX__ : _alloc.max_size();
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::resize(size_type n, value_type val) {
-	while (n > _size)
-		push_back(val);
-	while (n < _size)
-		pop_back();
-}
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::resize(size_type n, value_type val) {
+	size_type	len = size();
 
-template <typename T, typename Allocator>
-bool deque<T, Allocator>::empty() const {
-	return _size ? false : true;
+	if (n > len)
+		insert(end(), n - len, val);
+	else
+		_erase_at_end(_start + static_cast<difference_type>(n));
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::shrink_to_fit(void) {
-	return ;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+bool deque<T, Allocator, BlockBytes>::empty() const {
+	return _start == _finish;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::reference deque<T, Allocator>::operator [] (size_type n) {
-	link_type		node = _null->_next;
-	difference_type	offset = node->_right_border - node->_left;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::shrink_to_fit(void) {
+	size_type	num_nodes = _finish._node - _start._node + 1;
+	size_type	new_map_size = num_nodes + 2;
 
-	if (static_cast<size_type>(offset) >= n)
-		return *(node->_left + n);
-	n -= offset;
-	node = node->_next;
-	while (n > node->_capacity) {
-		n -= node->_capacity;
-		node = node->_next;
-	}
-	return *(node->_left_border + n - 1);
+	_release_spare_nodes();
+	if (new_map_size >= _map_size)
+		return ;
+
+	/* Move the used part of the map into a map with one free slot on each side */
+
+	map_pointer	new_map = _map_alloc.allocate(new_map_size);
+
+	for (size_type i = 0; i < num_nodes; ++i)
+		new_map[i + 1] = _start._node[i];
+	_map_alloc.deallocate(_map, _map_size);
+	_map = new_map;
+	_map_size = new_map_size;
+	_start.set_node(_map + 1);
+	_finish.set_node(_map + num_nodes);
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_reference deque<T, Allocator>::operator [] (size_type n) const {
-	link_type		node = _null->_next;
-	difference_type	offset = node->_right_border - node->_left;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::reference deque<T, Allocator, BlockBytes>::operator [] (size_type n) {
+	return _start[static_cast<difference_type>(n)];
+}
 
-	if (static_cast<size_type>(offset) < n) {
-		n -= offset;
-		node = node->_next;
-	}
-	while (n > node->_capacity) {
-		n -= node->_capacity;
-		node = node->_next;
-	}
-	return *(node->_left + n);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_reference deque<T, Allocator, BlockBytes>::operator [] (size_type n) const {
+	return _start[static_cast<difference_type>(n)];
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::reference deque<T, Allocator>::at(size_type n) {
-	if (n >= _size)
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::reference deque<T, Allocator, BlockBytes>::at(size_type n) {
+	if (n >= size())
 		throw std::out_of_range("deque");
 	return operator[](n);
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_reference deque<T, Allocator>::at(size_type n) const {
-	if (n >= _size)
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_reference deque<T, Allocator, BlockBytes>::at(size_type n) const {
+	if (n >= size())
 		throw std::out_of_range("deque");
 	return operator[](n);
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::reference deque<T, Allocator>::front() {
-	return *(_null->_next->_left);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::reference deque<T, Allocator, BlockBytes>::front() {
+	return *_start;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_reference deque<T, Allocator>::front() const {
-	return *(_null->_next->_left);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_reference deque<T, Allocator, BlockBytes>::front() const {
+	return *_start;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::reference deque<T, Allocator>::back() {
-	return *(_null->_prev->_right);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::reference deque<T, Allocator, BlockBytes>::back() {
+	return *(_finish - 1);
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::const_reference deque<T, Allocator>::back() const {
-	return *(_null->_prev->_right);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_reference deque<T, Allocator, BlockBytes>::back() const {
+	return *(_finish - 1);
 }
 
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, std::size_t BlockBytes>
 template <class InputIterator>
-void deque<T, Allocator>::assign(InputIterator first, InputIterator last) {
+void deque<T, Allocator, BlockBytes>::assign(InputIterator first, InputIterator last) {
 	typedef typename ft::is_integral<InputIterator>::type	_Type;
 	__assign(first, last, _Type());
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::assign(size_type n, const value_type& val) {
-	clear();
-	for (size_type i = 0; i < n; ++i)
-		push_back(val);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::assign(size_type n, const value_type& val) {
+	size_type	len = size();
+
+	/* Overwrite the elements in place and only construct or destroy the difference */
+
+	if (n > len) {
+		_fill(_start, _finish, val);
+		insert(end(), n - len, val);
+	}
+	else {
+		_fill(_start, _start + static_cast<difference_type>(n), val);
+		_erase_at_end(_start + static_cast<difference_type>(n));
+	}
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, std::size_t BlockBytes>
 template <typename _Iterator>
-void deque<T, Allocator>::__assign(_Iterator first, _Iterator last, ft::false_type) {
-	clear();
-	for (; first != last; ++first)
-		push_back(*first);
+void deque<T, Allocator, BlockBytes>::__assign(_Iterator first, _Iterator last, ft::false_type) {
+	typedef typename std::iterator_traits<_Iterator>::iterator_category	_Category;
+	__assign_range(first, last, _Category());
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, std::size_t BlockBytes>
 template <typename _Integer>
-void deque<T, Allocator>::__assign(_Integer n, const _Integer& val, ft::true_type) {
+void deque<T, Allocator, BlockBytes>::__assign(_Integer n, const _Integer& val, ft::true_type) {
 	assign(static_cast<size_type>(n), val);
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::push_back (const value_type& val) {
-	if (_null->_prev == _null || _null->_prev->_right == _null->_prev->_right_border)
-		_node_push_back();
-	_null->_prev->add_back(val);
-	_size++;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::push_back (const value_type& val) {
+	if (_finish._elem != _finish._last - 1) {
+		_alloc.construct(_finish._elem, val);
+		++_finish._elem;
+	}
+	else
+		_node_push_back(val);
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::push_front (const value_type& val) {
-	if (_null->_next == _null || _null->_next->_left == _null->_next->_left_border)
-		_node_push_front();
-	_null->_next->add_front(val);
-	_size++;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::push_front (const value_type& val) {
+	if (_start._elem != _start._first) {
+		_alloc.construct(_start._elem - 1, val);
+		--_start._elem;
+	}
+	else
+		_node_push_front(val);
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::pop_back() {
-	if (_null->_prev != _null) {
-		_null->_prev->remove_back();
-		_size--;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::pop_back() {
+	if (empty())
+		return ;
+	if (_finish._elem != _finish._first) {
+		--_finish._elem;
+		_alloc.destroy(_finish._elem);
 	}
-	if (_null->_prev != _null && !_null->_prev->_right)
+	else
 		_node_pop_back();
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::pop_front() {
-	if (_null->_next != _null) {
-		_null->_next->remove_front();
-		_size--;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::pop_front() {
+	if (empty())
+		return ;
+	if (_start._elem != _start._last - 1) {
+		_alloc.destroy(_start._elem);
+		++_start._elem;
 	}
-	if (_null->_next != _null && !_null->_next->_left)
+	else
 		_node_pop_front();
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::_node_push_back() {
-	link_type	ptr = _node_alloc.allocate(1);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_initialize_map(size_type n) {
+	size_type	num_nodes = n / node_type::_capacity + 1;
 
-	if (ptr) {
-		_node_alloc.construct(ptr);
-		_null->_prev->_next = ptr;
-		ptr->_prev = _null->_prev;
-		ptr->_next = _null;
-		_null->_prev = ptr;
-		ptr->init();
-	}
+	/* Keep spare map slots on both sides so that both ends can grow without reallocating the map */
+
+	_map_size = num_nodes + 2 > 8 ? num_nodes + 2 : 8;
+	_map = _map_alloc.allocate(_map_size);
+
+	map_pointer	nstart = _map + (_map_size - num_nodes) / 2;
+	map_pointer	nfinish = nstart + num_nodes - 1;
+
+	for (map_pointer cur = nstart; cur <= nfinish; ++cur)
+		*cur = _allocate_node();
+	_start.set_node(nstart);
+	_start._elem = _start._first;
+	_finish.set_node(nfinish);
+	_finish._elem = _finish._first + n % node_type::_capacity;
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::_node_push_front() {
-	link_type	ptr = _node_alloc.allocate(1);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_reallocate_map(size_type nodes_to_add, bool add_at_front) {
+	size_type	old_num_nodes = _finish._node - _start._node + 1;
+	size_type	new_num_nodes = old_num_nodes + nodes_to_add;
+	map_pointer	new_start;
 
-	if (ptr) {
-		_node_alloc.construct(ptr);
-		_null->_next->_prev = ptr;
-		ptr->_next = _null->_next;
-		ptr->_prev = _null;
-		_null->_next = ptr;
-		ptr->init();
+	if (_map_size > 2 * new_num_nodes) {
+
+		/* The map is mostly empty: recenter the used slots instead of growing it */
+
+		new_start = _map + (_map_size - new_num_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+		if (new_start < _start._node)
+			for (size_type i = 0; i < old_num_nodes; ++i)
+				new_start[i] = _start._node[i];
+		else
+			for (size_type i = old_num_nodes; i > 0; --i)
+				new_start[i - 1] = _start._node[i - 1];
 	}
+	else {
+		size_type	new_map_size = _map_size + (_map_size > nodes_to_add ? _map_size : nodes_to_add) + 2;
+		map_pointer	new_map = _map_alloc.allocate(new_map_size);
+
+		new_start = new_map + (new_map_size - new_num_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
+		for (size_type i = 0; i < old_num_nodes; ++i)
+			new_start[i] = _start._node[i];
+		_map_alloc.deallocate(_map, _map_size);
+		_map = new_map;
+		_map_size = new_map_size;
+	}
+	_start.set_node(new_start);
+	_finish.set_node(new_start + old_num_nodes - 1);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_reserve_map_at_back(size_type nodes_to_add) {
+	if (nodes_to_add + 1 > _map_size - (_finish._node - _map))
+		_reallocate_map(nodes_to_add, false);
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::_node_pop_back() {
-	link_type	ptr = _null->_prev;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_reserve_map_at_front(size_type nodes_to_add) {
+	if (nodes_to_add > static_cast<size_type>(_start._node - _map))
+		_reallocate_map(nodes_to_add, true);
+}
 
-	if (ptr != _null) {
-		ptr->_prev->_next = _null;
-		_null->_prev = ptr->_prev;
-		_node_alloc.destroy(ptr);
-		_node_alloc.deallocate(ptr, 1);
-	}
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_node_push_back(const value_type& val) {
+	_reserve_map_at_back();
+	*(_finish._node + 1) = _allocate_node();
+	_alloc.construct(_finish._elem, val);
+	_finish.set_node(_finish._node + 1);
+	_finish._elem = _finish._first;
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::_node_pop_front() {
-	link_type	ptr = _null->_next;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_node_push_front(const value_type& val) {
+	_reserve_map_at_front();
+	*(_start._node - 1) = _allocate_node();
+	_start.set_node(_start._node - 1);
+	_start._elem = _start._last - 1;
+	_alloc.construct(_start._elem, val);
+}
 
-	if (ptr != _null) {
-		ptr->_next->_prev = _null;
-		_null->_next = ptr->_next;
-		_node_alloc.destroy(ptr);
-		_node_alloc.deallocate(ptr, 1);
-	}
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_node_pop_back() {
+	_deallocate_node(_finish._first);
+	_finish.set_node(_finish._node - 1);
+	_finish._elem = _finish._last - 1;
+	_alloc.destroy(_finish._elem);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_node_pop_front() {
+	_alloc.destroy(_start._elem);
+	_deallocate_node(_start._first);
+	_start.set_node(_start._node + 1);
+	_start._elem = _start._first;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::pointer deque<T, Allocator, BlockBytes>::_allocate_node(void) {
+	if (_spare_size)
+		return _spare_nodes[--_spare_size];
+	return node_type::allocate(_alloc);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_deallocate_node(pointer block) {
+	if (_spare_size < _spare_capacity)
+		_spare_nodes[_spare_size++] = block;
+	else
+		node_type::deallocate(_alloc, block);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_release_spare_nodes(void) {
+	while (_spare_size)
+		node_type::deallocate(_alloc, _spare_nodes[--_spare_size]);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, std::size_t BlockBytes>
 template <class InputIterator>
-void deque<T, Allocator>::insert(iterator position, InputIterator first, InputIterator last) {
+void deque<T, Allocator, BlockBytes>::insert(iterator position, InputIterator first, InputIterator last) {
 	typedef typename ft::is_integral<InputIterator>::type _Type;
 	__insert(position, first, last, _Type());
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::iterator deque<T, Allocator>::insert(iterator position, const value_type& val) {
-	iterator	it = end();
-	
-	push_back(it == position ? val : back());
-	if (position == it)
-		return (it - 1);
-	--it;
-	while (it != position) {
-		*it = *(it - 1);
-		--it;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::insert(iterator position, const value_type& val) {
+	difference_type	index = position - _start;
+	value_type		copy(val);
+
+	if (position._elem == _start._elem) {
+		push_front(copy);
+		return _start;
+	}
+	if (position._elem == _finish._elem) {
+		push_back(copy);
+		return _finish - 1;
 	}
-	*it = val;
-	return it;
+
+	/* Shift whichever side of position is shorter, pushing may reallocate the map ==> recompute position from its index */
+
+	if (static_cast<size_type>(index) < size() / 2) {
+		push_front(front());
+		position = _start + index;
+		_copy(_start + 2, position + 1, _start + 1);
+	}
+	else {
+		push_back(back());
+		position = _start + index;
+		_copy_backward(position, _finish - 2, _finish - 1);
+	}
+	*position = copy;
+	return position;
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::insert(iterator position, size_type n, const value_type& val) {
-	for (size_type i = 0; i < n; ++i)
-		position = insert(position, val);
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::insert(iterator position, size_type n, const value_type& val) {
+	if (!n)
+		return ;
+	if (position._elem == _start._elem) {
+		iterator	new_start = _reserve_elements_at_front(n);
+
+		_uninitialized_fill(new_start, _start, val);
+		_start = new_start;
+	}
+	else if (position._elem == _finish._elem) {
+		iterator	new_finish = _reserve_elements_at_back(n);
+
+		_uninitialized_fill(_finish, new_finish, val);
+		_finish = new_finish;
+	}
+	else
+		_insert_aux(position, n, val);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, std::size_t BlockBytes>
 template <typename _Iterator>
-void deque<T, Allocator>::__insert(iterator position, _Iterator first, _Iterator last, ft::false_type) {
-	for (; first != last; ++first)
-		position = insert(position, *first);
+void deque<T, Allocator, BlockBytes>::__insert(iterator position, _Iterator first, _Iterator last, ft::false_type) {
+	typedef typename std::iterator_traits<_Iterator>::iterator_category	_Category;
+	__insert_range(position, first, last, _Category());
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, std::size_t BlockBytes>
 template <typename _Integer>
-void deque<T, Allocator>::__insert(iterator position, _Integer n, const _Integer& val, ft::true_type) {
+void deque<T, Allocator, BlockBytes>::__insert(iterator position, _Integer n, const _Integer& val, ft::true_type) {
 	insert(position, static_cast<size_type>(n), val);
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(iterator position) {
-	iterator it = position;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::erase(iterator position) {
+	return erase(position, position + 1);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::erase(iterator first, iterator last) {
+	difference_type	index = first - _start;
+	difference_type	n = last - first;
+
+	if (!n)
+		return first;
 
-	if ((it + 1) == end()) {
-		pop_back();
-		return end();
+	/* Close the gap from whichever side is shorter */
+
+	if (static_cast<size_type>(index) < (size() - n) / 2) {
+		_copy_backward(_start, first, last);
+		_erase_at_begin(_start + n);
 	}
-	while ((it + 1) != end()) {
-		*it = *(it + 1);
-		++it;
+	else {
+		_copy(last, _finish, first);
+		_erase_at_end(_finish - n);
 	}
-	pop_back();
-	return position;
+	return _start + index;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::swap(deque& x) {
+	map_pointer	map_copy = _map;
+	size_type	map_size_copy = _map_size;
+	iterator	start_copy = _start;
+	iterator	finish_copy = _finish;
+	size_type	spare_size_copy = _spare_size;
+	pointer		spare_copy[_spare_capacity];
+
+	_map = x._map; x._map = map_copy;
+	_map_size = x._map_size; x._map_size = map_size_copy;
+	_start = x._start; x._start = start_copy;
+	_finish = x._finish; x._finish = finish_copy;
+
+	/* Only the live entries of each cache are moved, the slots past _spare_size hold nothing */
+
+	for (size_type i = 0; i < _spare_size; ++i)
+		spare_copy[i] = _spare_nodes[i];
+	for (size_type i = 0; i < x._spare_size; ++i)
+		_spare_nodes[i] = x._spare_nodes[i];
+	for (size_type i = 0; i < spare_size_copy; ++i)
+		x._spare_nodes[i] = spare_copy[i];
+	_spare_size = x._spare_size; x._spare_size = spare_size_copy;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::clear(void) {
+	/* Keep the first block so that the deque stays usable without a new allocation */
+
+	_erase_at_end(_start);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+template <typename InputIterator>
+void deque<T, Allocator, BlockBytes>::__assign_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
+	iterator	cur = _start;
+
+	for (; first != last && cur != _finish; ++first, ++cur)
+		*cur = *first;
+	if (first == last)
+		_erase_at_end(cur);
+	else
+		for (; first != last; ++first)
+			push_back(*first);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+template <typename ForwardIterator>
+void deque<T, Allocator, BlockBytes>::__assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+	size_type	n = std::distance(first, last);
+	size_type	len = size();
+	iterator	cur = _start;
+
+	if (n > len) {
+		ForwardIterator	mid = first;
+
+		std::advance(mid, len);
+		for (; first != mid; ++first, ++cur)
+			*cur = *first;
+		__insert_range(_finish, mid, last, std::forward_iterator_tag());
+	}
+	else {
+		for (; first != last; ++first, ++cur)
+			*cur = *first;
+		_erase_at_end(cur);
+	}
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+template <typename InputIterator>
+void deque<T, Allocator, BlockBytes>::__insert_range(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag) {
+	for (; first != last; ++first) {
+		position = insert(position, *first);
+		++position;
+	}
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+template <typename ForwardIterator>
+void deque<T, Allocator, BlockBytes>::__insert_range(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+	size_type	n = std::distance(first, last);
+
+	if (!n)
+		return ;
+	if (position._elem == _start._elem) {
+		iterator	new_start = _reserve_elements_at_front(n);
+
+		_uninitialized_copy(first, new_start, _start);
+		_start = new_start;
+	}
+	else if (position._elem == _finish._elem) {
+		iterator	new_finish = _reserve_elements_at_back(n);
+
+		_uninitialized_copy(first, _finish, new_finish);
+		_finish = new_finish;
+	}
+	else
+		_insert_aux(position, first, last, n);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_insert_aux(iterator position, size_type n, const value_type& val) {
+	difference_type	index = position - _start;
+	size_type		length = size();
+	value_type		copy(val);
+
+	/* Reserving may have reallocated the map ==> recompute position from its index */
+
+	if (static_cast<size_type>(index) < length / 2) {
+		iterator	new_start = _reserve_elements_at_front(n);
+		iterator	old_start = _start;
+
+		position = _start + index;
+		if (static_cast<size_type>(index) >= n) {
+			iterator	start_n = _start + static_cast<difference_type>(n);
+
+			_uninitialized_copy(const_iterator(_start), new_start, old_start);
+			_start = new_start;
+			_copy(start_n, position, old_start);
+			_fill(position - static_cast<difference_type>(n), position, copy);
+		}
+		else {
+			iterator	mid = new_start + index;
+
+			_uninitialized_copy(const_iterator(_start), new_start, mid);
+			_uninitialized_fill(mid, old_start, copy);
+			_start = new_start;
+			_fill(old_start, position, copy);
+		}
+	}
+	else {
+		size_type	elems_after = length - index;
+		iterator	new_finish = _reserve_elements_at_back(n);
+		iterator	old_finish = _finish;
+
+		position = _start + index;
+		if (elems_after > n) {
+			iterator	finish_n = _finish - static_cast<difference_type>(n);
+
+			_uninitialized_copy(const_iterator(finish_n), _finish, new_finish);
+			_finish = new_finish;
+			_copy_backward(position, finish_n, old_finish);
+			_fill(position, position + static_cast<difference_type>(n), copy);
+		}
+		else {
+			iterator	mid = position + static_cast<difference_type>(n);
+
+			_uninitialized_fill(_finish, mid, copy);
+			_uninitialized_copy(const_iterator(position), mid, new_finish);
+			_finish = new_finish;
+			_fill(position, old_finish, copy);
+		}
+	}
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+template <typename ForwardIterator>
+void deque<T, Allocator, BlockBytes>::_insert_aux(iterator position, ForwardIterator first, ForwardIterator last, size_type n) {
+	difference_type	index = position - _start;
+	size_type		length = size();
+
+	if (static_cast<size_type>(index) < length / 2) {
+		iterator	new_start = _reserve_elements_at_front(n);
+		iterator	old_start = _start;
+
+		position = _start + index;
+		if (static_cast<size_type>(index) >= n) {
+			iterator	start_n = _start + static_cast<difference_type>(n);
+
+			_uninitialized_copy(const_iterator(_start), new_start, old_start);
+			_start = new_start;
+			_copy(start_n, position, old_start);
+			for (position -= static_cast<difference_type>(n); first != last; ++first, ++position)
+				*position = *first;
+		}
+		else {
+			iterator		mid = new_start + index;
+			ForwardIterator	split = first;
+
+			std::advance(split, n - index);
+			_uninitialized_copy(const_iterator(_start), new_start, mid);
+			_uninitialized_copy(first, mid, old_start);
+			_start = new_start;
+			for (; split != last; ++split, ++old_start)
+				*old_start = *split;
+		}
+	}
+	else {
+		size_type	elems_after = length - index;
+		iterator	new_finish = _reserve_elements_at_back(n);
+		iterator	old_finish = _finish;
+
+		position = _start + index;
+		if (elems_after > n) {
+			iterator	finish_n = _finish - static_cast<difference_type>(n);
+
+			_uninitialized_copy(const_iterator(finish_n), _finish, new_finish);
+			_finish = new_finish;
+			_copy_backward(position, finish_n, old_finish);
+			for (; first != last; ++first, ++position)
+				*position = *first;
+		}
+		else {
+			iterator		mid = position + static_cast<difference_type>(n);
+			ForwardIterator	split = first;
+
+			std::advance(split, elems_after);
+			_uninitialized_copy(split, _finish, mid);
+			_uninitialized_copy(const_iterator(position), mid, new_finish);
+			_finish = new_finish;
+			for (; first != split; ++first, ++position)
+				*position = *first;
+		}
+	}
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::_reserve_elements_at_back(size_type n) {
+	size_type	vacancies = (_finish._last - _finish._elem) - 1;
+
+	if (n > vacancies) {
+		size_type	new_nodes = (n - vacancies + node_type::_capacity - 1) / node_type::_capacity;
+
+		_reserve_map_at_back(new_nodes);
+		for (size_type i = 1; i <= new_nodes; ++i)
+			*(_finish._node + i) = _allocate_node();
+	}
+	return _finish + static_cast<difference_type>(n);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::_reserve_elements_at_front(size_type n) {
+	size_type	vacancies = _start._elem - _start._first;
+
+	if (n > vacancies) {
+		size_type	new_nodes = (n - vacancies + node_type::_capacity - 1) / node_type::_capacity;
+
+		_reserve_map_at_front(new_nodes);
+		for (size_type i = 1; i <= new_nodes; ++i)
+			*(_start._node - i) = _allocate_node();
+	}
+	return _start - static_cast<difference_type>(n);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_erase_at_begin(iterator position) {
+	for (iterator it = _start; it != position; ++it)
+		_alloc.destroy(it._elem);
+	for (map_pointer node = _start._node; node < position._node; ++node)
+		_deallocate_node(*node);
+	_start = position;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_erase_at_end(iterator position) {
+	for (iterator it = position; it != _finish; ++it)
+		_alloc.destroy(it._elem);
+	for (map_pointer node = position._node + 1; node <= _finish._node; ++node)
+		_deallocate_node(*node);
+	_finish = position;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_fill(iterator first, iterator last, const value_type& val) {
+	while (first._node != last._node) {
+		for (pointer elem = first._elem; elem != first._last; ++elem)
+			*elem = val;
+		first.set_node(first._node + 1);
+		first._elem = first._first;
+	}
+	for (pointer elem = first._elem; elem != last._elem; ++elem)
+		*elem = val;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::_copy(iterator first, iterator last, iterator dest) {
+	difference_type	length = last - first;
+
+	/* Move one contiguous run at a time: the longest stretch that stays inside both the source and the destination block */
+
+	while (length > 0) {
+		difference_type	n = length;
+
+		if (n > first._last - first._elem)
+			n = first._last - first._elem;
+		if (n > dest._last - dest._elem)
+			n = dest._last - dest._elem;
+
+		__move_block(first._elem, first._elem + n, dest._elem, trivial_type());
+		first += n;
+		dest += n;
+		length -= n;
+	}
+	return dest;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::iterator deque<T, Allocator, BlockBytes>::_copy_backward(iterator first, iterator last, iterator dest_last) {
+	difference_type	length = last - first;
+
+	while (length > 0) {
+		difference_type	last_run = last._elem - last._first;
+		pointer			last_elem = last._elem;
+		difference_type	dest_run = dest_last._elem - dest_last._first;
+		pointer			dest_elem = dest_last._elem;
+
+		/* An iterator at the start of a block ends the run of the previous block */
+
+		if (!last_run) {
+			last_run = node_type::_capacity;
+			last_elem = *(last._node - 1) + last_run;
+		}
+		if (!dest_run) {
+			dest_run = node_type::_capacity;
+			dest_elem = *(dest_last._node - 1) + dest_run;
+		}
+
+		difference_type	n = length;
+
+		if (n > last_run)
+			n = last_run;
+		if (n > dest_run)
+			n = dest_run;
+
+		__move_block_backward(last_elem - n, last_elem, dest_elem, trivial_type());
+		last -= n;
+		dest_last -= n;
+		length -= n;
+	}
+	return dest_last;
 }
 
-template <typename T, typename Allocator>
-typename deque<T, Allocator>::iterator deque<T, Allocator>::erase(iterator first, iterator last) {
-	for (; first != last; --last)
-		first = erase(first);
-	return first;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::_uninitialized_fill(iterator first, iterator last, const value_type& val) {
+	while (first._node != last._node) {
+		__fill_block(first._elem, first._last, val, trivial_type());
+		first.set_node(first._node + 1);
+		first._elem = first._first;
+	}
+	__fill_block(first._elem, last._elem, val, trivial_type());
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::swap(deque& x) {
-	deque b = x;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+template <typename _Iterator>
+_Iterator deque<T, Allocator, BlockBytes>::_uninitialized_copy(_Iterator src, iterator first, iterator last) {
+	while (first._node != last._node) {
+		src = __copy_to_block(src, first._elem, first._last);
+		first.set_node(first._node + 1);
+		first._elem = first._first;
+	}
+	return __copy_to_block(src, first._elem, last._elem);
+}
 
-	x = *this;
-	*this = b;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+template <typename _Iterator>
+_Iterator deque<T, Allocator, BlockBytes>::__copy_to_block(_Iterator src, pointer first, pointer last) {
+	for (; first != last; ++first, ++src)
+		_alloc.construct(first, *src);
+	return src;
 }
 
-template <typename T, typename Allocator>
-void deque<T, Allocator>::clear(void) {
-	link_type	buf = _null->_next;
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_iterator deque<T, Allocator, BlockBytes>::__copy_to_block(const_iterator src, pointer first, pointer last) {
+	/* The source is a deque too ==> copy it one source block at a time */
+
+	while (first != last) {
+		difference_type	n = src._last - src._elem;
 
-	while (buf != _null) {
-		_null->_next = buf->_next;
-		_node_alloc.destroy(buf);
-		_node_alloc.deallocate(buf, 1);
-		buf = _null->_next;
+		if (n > last - first)
+			n = last - first;
+		__copy_block(src._elem, first, first + n, trivial_type());
+		first += n;
+		src += n;
 	}
-	_size = 0;
-	_null->_next = _null;
-	_null->_prev = _null;
+	return src;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::const_pointer deque<T, Allocator, BlockBytes>::__copy_to_block(const_pointer src, pointer first, pointer last) {
+	__copy_block(src, first, last, trivial_type());
+	return src + (last - first);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::pointer deque<T, Allocator, BlockBytes>::__copy_to_block(pointer src, pointer first, pointer last) {
+	__copy_block(src, first, last, trivial_type());
+	return src + (last - first);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__copy_block(const_pointer src, pointer first, pointer last, ft::true_type) {
+	if (first != last)
+		std::memcpy(static_cast<void*>(first), static_cast<const void*>(src), (last - first) * sizeof (value_type));
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__copy_block(const_pointer src, pointer first, pointer last, ft::false_type) {
+	for (; first != last; ++first, ++src)
+		_alloc.construct(first, *src);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__move_block(pointer first, pointer last, pointer dest, ft::true_type) {
+	if (first != last)
+		std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof (value_type));
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__move_block(pointer first, pointer last, pointer dest, ft::false_type) {
+	for (; first != last; ++first, ++dest)
+		*dest = *first;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__move_block_backward(pointer first, pointer last, pointer dest_last, ft::true_type) {
+	if (first != last)
+		std::memmove(static_cast<void*>(dest_last - (last - first)), static_cast<const void*>(first), (last - first) * sizeof (value_type));
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__move_block_backward(pointer first, pointer last, pointer dest_last, ft::false_type) {
+	while (first != last)
+		*--dest_last = *--last;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__fill_block(pointer first, pointer last, const value_type& val, ft::true_type) {
+	for (; first != last; ++first)
+		*first = val;
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+void deque<T, Allocator, BlockBytes>::__fill_block(pointer first, pointer last, const value_type& val, ft::false_type) {
+	for (; first != last; ++first)
+		_alloc.construct(first, val);
+}
+
+template <typename T, typename Allocator, std::size_t BlockBytes>
+typename deque<T, Allocator, BlockBytes>::allocator_type deque<T, Allocator, BlockBytes>::get_allocator(void) {
+	return _alloc;
 }
 
 
-template <typename T, typename Allocator>
-bool operator == (const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs) {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+bool operator == (const deque<T, Allocator, BlockBytes>& lhs, const deque<T, Allocator, BlockBytes>& rhs) {
 	if (lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()))
 		return true;
 	return false;
 }
 
-template <typename T, typename Allocator>
-bool operator != (const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs) {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+bool operator != (const deque<T, Allocator, BlockBytes>& lhs, const deque<T, Allocator, BlockBytes>& rhs) {
 	return !(lhs == rhs);
 }
 
-template <typename T, typename Allocator>
-bool operator < (const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs) {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+bool operator < (const deque<T, Allocator, BlockBytes>& lhs, const deque<T, Allocator, BlockBytes>& rhs) {
 	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename T, typename Allocator>
-bool operator <= (const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs) {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+bool operator <= (const deque<T, Allocator, BlockBytes>& lhs, const deque<T, Allocator, BlockBytes>& rhs) {
 	return !(rhs < lhs);
 }
 
-template <typename T, typename Allocator>
-bool operator > (const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs) {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+bool operator > (const deque<T, Allocator, BlockBytes>& lhs, const deque<T, Allocator, BlockBytes>& rhs) {
 	return (rhs < lhs);
 }
 
-template <typename T, typename Allocator>
-bool operator >= (const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs) {
+template <typename T, typename Allocator, std::size_t BlockBytes>
+bool operator >= (const deque<T, Allocator, BlockBytes>& lhs, const deque<T, Allocator, BlockBytes>& rhs) {
 	return !(lhs < rhs);
 }
 
-template <class T, class Allocator>
-void swap (deque<T, Allocator>& x, deque<T, Allocator>& y) {
+template <class T, class Allocator, std::size_t BlockBytes>
+void swap (deque<T, Allocator, BlockBytes>& x, deque<T, Allocator, BlockBytes>& y) {
 	x.swap(y);
 }
 
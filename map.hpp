@@ -13,16 +13,25 @@
 #ifndef MAP_H
 # define MAP_H
 
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 # include "Additional/less.hpp"
 # include "Additional/equal.hpp"
+# include "Additional/select_first.hpp"
+# include "Additional/is_transparent.hpp"
+# include "Additional/order_statistics.hpp"
 # include "Additional/red_black_tree.hpp"
+# include "Additional/node_handle.hpp"
+# include "Additional/sorted_unique.hpp"
 # include "Additional/lexicographical_compare.hpp"
+# include "Additional/merge_iterator.hpp"
 
 namespace ft
 {
 
 
-template <typename Key, typename T, typename Compare = ft::less<Key>, typename Allocator = std::allocator<ft::pair<const Key, T> > >
+template <typename Key, typename T, typename Compare = ft::less<Key>, typename Allocator = std::allocator<ft::pair<const Key, T> >, typename Policy = ft::no_order_statistics>
 class map {
 
 public:
@@ -52,7 +61,8 @@ public:
 	};
 
 private:
-	typedef typename ft::red_black_tree<value_type, value_compare, Allocator>		tree_type;
+	typedef typename ft::red_black_tree<value_type, ft::select_first<value_type>, key_compare, Allocator, Policy>	tree_type;
+	typedef typename tree_type::link_type											link_type;
 	
 public:
 	typedef typename tree_type::pointer 											pointer;
@@ -66,12 +76,16 @@ public:
 	typedef Allocator																allocator_type;
 	typedef	std::ptrdiff_t															difference_type;
 	typedef	std::size_t																size_type;
+	typedef ft::node_handle<tree_type, key_type, mapped_type>							node_type;
+	typedef ft::insert_return_type<iterator, node_type>									insert_return_type;
 
 	/* ASSIGNMENT */
 
 	explicit map (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
 	template <class InputIterator>
 	map(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
+	template <class InputIterator>
+	map(ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
 	map(const map& other);
 	~map();
 
@@ -100,11 +114,37 @@ public:
 	void								insert(InputIterator first, InputIterator last);
 	pair<iterator,bool>					insert(const value_type& val);
 	iterator							insert(iterator position, const value_type& val);
+# if __cplusplus >= 201103L
+	insert_return_type					insert(node_type&& nh);
+# else
+	insert_return_type					insert(const node_type& nh);
+# endif
+	node_type							extract(iterator position);
+	node_type							extract(const key_type& k);
+# if __cplusplus >= 201103L
+	template <typename... Args>
+	pair<iterator,bool>					try_emplace(const key_type& k, Args&&... args);
+	template <typename M>
+	pair<iterator,bool>					insert_or_assign(const key_type& k, M&& obj);
+# else
+	pair<iterator,bool>					try_emplace(const key_type& k);
+	template <typename A1>
+	pair<iterator,bool>					try_emplace(const key_type& k, const A1& a1);
+	template <typename A1, typename A2>
+	pair<iterator,bool>					try_emplace(const key_type& k, const A1& a1, const A2& a2);
+	template <typename A1, typename A2, typename A3>
+	pair<iterator,bool>					try_emplace(const key_type& k, const A1& a1, const A2& a2, const A3& a3);
+	template <typename M>
+	pair<iterator,bool>					insert_or_assign(const key_type& k, const M& obj);
+# endif
 	void								erase(iterator position);
 	size_type							erase(const key_type& k);
     void								erase(iterator first, iterator last);
 	void								swap(map& x);
 	void								clear(void);
+	map								split_at(const key_type& k);
+	void								split_at(const key_type& k, map& greater);
+	void								merge_disjoint(map& other);
 
 	/* COMPARISON OBJECTS */
 
@@ -126,6 +166,33 @@ public:
 	pair<const_iterator,const_iterator>	equal_range(const key_type& k) const;
 	pair<iterator,iterator>				equal_range(const key_type& k);
 
+	/* ORDER STATISTICS: only available with ft::order_statistics as Policy */
+
+	iterator							nth(size_type n);
+	const_iterator						nth(size_type n) const;
+	size_type							rank(const key_type& k) const;
+
+	/* HETEROGENEOUS LOOKUP: only available when key_compare declares is_transparent */
+
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									find(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							find(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, size_type>::type									count(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									lower_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							lower_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									upper_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							upper_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<iterator,iterator> >::type					equal_range(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<const_iterator,const_iterator> >::type		equal_range(const K& k) const;
+
 	/* ALLOCATOR */
 
 	allocator_type						get_allocator() const;
@@ -136,27 +203,29 @@ public:
 
 /* CONSTRUCTORS AND DESTRUCTOR START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-map<Key, T, Compare, Allocator>::map (const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) { }
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy>::map (const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) { }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
 template <class InputIterator>
-map<Key, T, Compare, Allocator>::map(InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
-	for (; first != last; ++first)
-		_tree.insert(nullptr, *first);
+map<Key, T, Compare, Allocator, Policy>::map(InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
+	_tree.insert_range(first, last);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-map<Key, T, Compare, Allocator>::map(const map& other) : _tree(other._tree._compare, other._tree._alloc) {
-	for (const_iterator it1 = other.begin(), it2 = other.end(); it1 != it2; ++it1)
-		_tree.insert(nullptr, *it1);
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <class InputIterator>
+map<Key, T, Compare, Allocator, Policy>::map(ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
+	_tree.insert_sorted(first, last);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-map<Key, T, Compare, Allocator>::~map() { }
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy>::map(const map& other) : _tree(other._tree) { }
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy>::~map() { }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-map<Key, T, Compare, Allocator>& map<Key, T, Compare, Allocator>::operator = (const map& other) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy>& map<Key, T, Compare, Allocator, Policy>::operator = (const map& other) {
 	_tree = other._tree;
 	return *this;
 }
@@ -165,43 +234,43 @@ map<Key, T, Compare, Allocator>& map<Key, T, Compare, Allocator>::operator = (co
 
 /* ITERATORS START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::iterator map<Key, T, Compare, Allocator>::begin() {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator map<Key, T, Compare, Allocator, Policy>::begin() {
 	return _tree.begin();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::iterator map<Key, T, Compare, Allocator>::end() {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator map<Key, T, Compare, Allocator, Policy>::end() {
 	return _tree.end();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::const_iterator map<Key, T, Compare, Allocator>::begin() const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator map<Key, T, Compare, Allocator, Policy>::begin() const {
 	return _tree.begin();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::const_iterator map<Key, T, Compare, Allocator>::end() const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator map<Key, T, Compare, Allocator, Policy>::end() const {
 	return _tree.end();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::reverse_iterator map<Key, T, Compare, Allocator>::rbegin() {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::reverse_iterator map<Key, T, Compare, Allocator, Policy>::rbegin() {
 	return _tree.rbegin();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::reverse_iterator map<Key, T, Compare, Allocator>::rend() {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::reverse_iterator map<Key, T, Compare, Allocator, Policy>::rend() {
 	return _tree.rend();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::const_reverse_iterator map<Key, T, Compare, Allocator>::rbegin() const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_reverse_iterator map<Key, T, Compare, Allocator, Policy>::rbegin() const {
 	return _tree.rbegin();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::const_reverse_iterator map<Key, T, Compare, Allocator>::rend() const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_reverse_iterator map<Key, T, Compare, Allocator, Policy>::rend() const {
 	return _tree.rend();
 }
 
@@ -209,18 +278,18 @@ typename map<Key, T, Compare, Allocator>::const_reverse_iterator map<Key, T, Com
 
 /* CAPACITY START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-bool map<Key, T, Compare, Allocator>::empty() const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+bool map<Key, T, Compare, Allocator, Policy>::empty() const {
 	return size() ? false : true;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::size_type map<Key, T, Compare, Allocator>::size(void) const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type map<Key, T, Compare, Allocator, Policy>::size(void) const {
 	return _tree.size();
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::size_type map<Key, T, Compare, Allocator>::max_size(void) const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type map<Key, T, Compare, Allocator, Policy>::max_size(void) const {
 	return _tree._alloc.max_size() > __LONG_LONG_MAX__ ? __LONG_LONG_MAX__ : _tree._alloc.max_size();
 }
 
@@ -228,30 +297,163 @@ typename map<Key, T, Compare, Allocator>::size_type map<Key, T, Compare, Allocat
 
 /* MODIFIERS START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
 template <class InputIterator>
-void map<Key, T, Compare, Allocator>::insert(InputIterator first, InputIterator last) {
-	for (; first != last; ++first)
-		_tree.insert(nullptr, *first);
+void map<Key, T, Compare, Allocator, Policy>::insert(InputIterator first, InputIterator last) {
+	_tree.insert_range(first, last);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-ft::pair<typename map<Key, T, Compare, Allocator>::iterator, bool> map<Key, T, Compare, Allocator>::insert(const value_type& val) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::insert(const value_type& val) {
 	return _tree.insert(nullptr, val);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::iterator map<Key, T, Compare, Allocator>::insert(iterator position, const value_type& val) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator map<Key, T, Compare, Allocator, Policy>::insert(iterator position, const value_type& val) {
 	return _tree.insert(position._base, val).first;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-void map<Key, T, Compare, Allocator>::erase(iterator position) {
+/* The handle's node is relinked as is, its allocator must compare equal to the map's. If the key is already there it stays in the handle */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+# if __cplusplus >= 201103L
+typename map<Key, T, Compare, Allocator, Policy>::insert_return_type map<Key, T, Compare, Allocator, Policy>::insert(node_type&& nh) {
+# else
+typename map<Key, T, Compare, Allocator, Policy>::insert_return_type map<Key, T, Compare, Allocator, Policy>::insert(const node_type& nh) {
+# endif
+	insert_return_type			result;
+	ft::pair<iterator, bool>	inserted;
+
+	result.position = end();
+	result.inserted = false;
+	if (nh.empty())
+		return result;
+	inserted = _tree.insert_node(nh._node);
+	result.position = inserted.first;
+	result.inserted = inserted.second;
+	if (inserted.second)
+		nh.release();
+	else
+# if __cplusplus >= 201103L
+		result.node = std::move(nh);
+# else
+		result.node = nh;
+# endif
+	return result;
+}
+
+/* The node leaves the tree without being copied || freed */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::node_type map<Key, T, Compare, Allocator, Policy>::extract(iterator position) {
+	return node_type(_tree.extract(position), _tree._alloc);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::node_type map<Key, T, Compare, Allocator, Policy>::extract(const key_type& k) {
+	return extract(find(k));
+}
+
+# if __cplusplus >= 201103L
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename... Args>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::try_emplace(const key_type& k, Args&&... args) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = _tree.find_position(k, parent, left);
+
+	if (found)
+		return ft::make_pair(iterator(found, _tree._null), false);
+	return ft::make_pair(_tree.insert_at(parent, left, k, mapped_type(std::forward<Args>(args)...)), true);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename M>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::insert_or_assign(const key_type& k, M&& obj) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = _tree.find_position(k, parent, left);
+
+	if (found) {
+		found->value.second = std::forward<M>(obj);
+		return ft::make_pair(iterator(found, _tree._null), false);
+	}
+	return ft::make_pair(_tree.insert_at(parent, left, k, std::forward<M>(obj)), true);
+}
+
+# else
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::try_emplace(const key_type& k) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = _tree.find_position(k, parent, left);
+
+	if (found)
+		return ft::make_pair(iterator(found, _tree._null), false);
+	return ft::make_pair(_tree.insert_at(parent, left, k, mapped_type()), true);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename A1>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::try_emplace(const key_type& k, const A1& a1) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = _tree.find_position(k, parent, left);
+
+	if (found)
+		return ft::make_pair(iterator(found, _tree._null), false);
+	return ft::make_pair(_tree.insert_at(parent, left, k, mapped_type(a1)), true);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename A1, typename A2>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::try_emplace(const key_type& k, const A1& a1, const A2& a2) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = _tree.find_position(k, parent, left);
+
+	if (found)
+		return ft::make_pair(iterator(found, _tree._null), false);
+	return ft::make_pair(_tree.insert_at(parent, left, k, mapped_type(a1, a2)), true);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename A1, typename A2, typename A3>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::try_emplace(const key_type& k, const A1& a1, const A2& a2, const A3& a3) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = _tree.find_position(k, parent, left);
+
+	if (found)
+		return ft::make_pair(iterator(found, _tree._null), false);
+	return ft::make_pair(_tree.insert_at(parent, left, k, mapped_type(a1, a2, a3)), true);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename M>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, bool> map<Key, T, Compare, Allocator, Policy>::insert_or_assign(const key_type& k, const M& obj) {
+	link_type	parent = nullptr;
+	bool		left = true;
+	link_type	found = _tree.find_position(k, parent, left);
+
+	if (found) {
+		found->value.second = obj;
+		return ft::make_pair(iterator(found, _tree._null), false);
+	}
+	return ft::make_pair(_tree.insert_at(parent, left, k, obj), true);
+}
+
+# endif
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::erase(iterator position) {
 	_tree.erase(position._base);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::size_type map<Key, T, Compare, Allocator>::erase(const key_type& k) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type map<Key, T, Compare, Allocator, Policy>::erase(const key_type& k) {
 	iterator	it = find(k);
 
 	if (it != end()) {
@@ -261,8 +463,8 @@ typename map<Key, T, Compare, Allocator>::size_type map<Key, T, Compare, Allocat
 	return 0;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-void map<Key, T, Compare, Allocator>::erase(iterator first, iterator last) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::erase(iterator first, iterator last) {
 	size_type	arr_size = std::distance(first, last);
 	key_type*	array = new key_type [arr_size];
 
@@ -275,39 +477,75 @@ void map<Key, T, Compare, Allocator>::erase(iterator first, iterator last) {
 	delete [] array;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-void map<Key, T, Compare, Allocator>::swap(map& x) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::swap(map& x) {
 	tree_type	buf = x._tree;
 
 	x._tree = _tree;
 	_tree = buf;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-void map<Key, T, Compare, Allocator>::clear(void) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::clear(void) {
 	_tree.clear();
 }
 
+/* The elements not less than k are moved to the returned map: O(log n), the nodes are relinked, not copied */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy> map<Key, T, Compare, Allocator, Policy>::split_at(const key_type& k) {
+	map	greater(key_comp(), get_allocator());
+
+	split_at(k, greater);
+	return greater;
+}
+
+/* Same, into an existing map whose elements are dropped ==> no copy on assignment. Its allocator must compare
+   equal to this map's for the nodes to be relinked, they are copied otherwise */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::split_at(const key_type& k, map& greater) {
+	if (this != &greater)
+		_tree.split(k, greater._tree);
+}
+
+/* All of other's keys after || before this map's ones ==> its nodes are relinked in O(log n), || copied when
+   the allocators differ. Otherwise the elements are moved one by one, the ones whose key is already here stay in other */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+void map<Key, T, Compare, Allocator, Policy>::merge_disjoint(map& other) {
+	iterator	it;
+
+	if (this == &other || _tree.join(other._tree))
+		return ;
+	for (it = other.begin(); it != other.end(); ) {
+		if (insert(*it).second)
+			other.erase(it++);
+		else
+			++it;
+	}
+}
+
 /* <-- MODIFIERS END */
 
 /* COMPARISON OBJECTS START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::key_compare map<Key, T, Compare, Allocator>::key_comp(void) const {
-	return key_compare();	
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::key_compare map<Key, T, Compare, Allocator, Policy>::key_comp(void) const {
+	return _tree._compare;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::value_compare map<Key, T, Compare, Allocator>::value_comp(void) const {
-	return value_compare();
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::value_compare map<Key, T, Compare, Allocator, Policy>::value_comp(void) const {
+	return value_compare(_tree._compare);
 }
 
 /* <-- COMPARISON OBJECTS END */
 
 /* ELEMENT ACCESS START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::mapped_type& map<Key, T, Compare, Allocator>::at(const key_type& k) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::mapped_type& map<Key, T, Compare, Allocator, Policy>::at(const key_type& k) {
 	iterator it = find(k);
 
 	if (it == end())
@@ -315,8 +553,8 @@ typename map<Key, T, Compare, Allocator>::mapped_type& map<Key, T, Compare, Allo
 	return (*it).second;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-const typename map<Key, T, Compare, Allocator>::mapped_type& map<Key, T, Compare, Allocator>::at(const key_type& k) const {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+const typename map<Key, T, Compare, Allocator, Policy>::mapped_type& map<Key, T, Compare, Allocator, Policy>::at(const key_type& k) const {
 	const_iterator it = find(k);
 
 	if (it == end())
@@ -324,112 +562,262 @@ const typename map<Key, T, Compare, Allocator>::mapped_type& map<Key, T, Compare
 	return (*it).second;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::mapped_type& map<Key, T, Compare, Allocator>::operator [] (const key_type& k) {
-	iterator it = find(k);
-
-	if (it == end())
-		it = insert(ft::make_pair(k, mapped_type())).first;
-	return (*it).second;
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::mapped_type& map<Key, T, Compare, Allocator, Policy>::operator [] (const key_type& k) {
+	return try_emplace(k).first->second;
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::iterator map<Key, T, Compare, Allocator>::find(const key_type& k) {
-	return _tree.find(value_type(k, mapped_type()));
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator map<Key, T, Compare, Allocator, Policy>::find(const key_type& k) {
+	return _tree.find(k);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::const_iterator map<Key, T, Compare, Allocator>::find(const key_type& k) const {
-	return _tree.find(value_type(k, mapped_type()));
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator map<Key, T, Compare, Allocator, Policy>::find(const key_type& k) const {
+	return _tree.find(k);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::size_type map<Key, T, Compare, Allocator>::count(const key_type& k) const {
-	return (_tree.find(value_type(k, mapped_type())) == end() ? 0 : 1);
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type map<Key, T, Compare, Allocator, Policy>::count(const key_type& k) const {
+	return (_tree.find(k) == end() ? 0 : 1);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::iterator map<Key, T, Compare, Allocator>::lower_bound(const key_type& k) {
-	return _tree.lower_bound(value_type(k, mapped_type()));
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator map<Key, T, Compare, Allocator, Policy>::lower_bound(const key_type& k) {
+	return _tree.lower_bound(k);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::const_iterator map<Key, T, Compare, Allocator>::lower_bound(const key_type& k) const {
-	return _tree.lower_bound(value_type(k, mapped_type()));
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator map<Key, T, Compare, Allocator, Policy>::lower_bound(const key_type& k) const {
+	return _tree.lower_bound(k);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::iterator map<Key, T, Compare, Allocator>::upper_bound(const key_type& k) {
-	return _tree.upper_bound(value_type(k, mapped_type()));
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator map<Key, T, Compare, Allocator, Policy>::upper_bound(const key_type& k) {
+	return _tree.upper_bound(k);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::const_iterator map<Key, T, Compare, Allocator>::upper_bound(const key_type& k) const {
-	return _tree.upper_bound(value_type(k, mapped_type()));
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator map<Key, T, Compare, Allocator, Policy>::upper_bound(const key_type& k) const {
+	return _tree.upper_bound(k);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-ft::pair<typename map<Key, T, Compare, Allocator>::const_iterator, typename map<Key, T, Compare, Allocator>::const_iterator> map<Key, T, Compare, Allocator>::equal_range(const key_type& k) const {
-	return ft::make_pair(lower_bound(k), upper_bound(k));
-};
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::const_iterator, typename map<Key, T, Compare, Allocator, Policy>::const_iterator> map<Key, T, Compare, Allocator, Policy>::equal_range(const key_type& k) const {
+	return _tree.equal_range_unique(k);
+}
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-ft::pair<typename map<Key, T, Compare, Allocator>::iterator, typename map<Key, T, Compare, Allocator>::iterator> map<Key, T, Compare, Allocator>::equal_range(const key_type& k) {
-	return ft::make_pair(lower_bound(k), upper_bound(k));
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, typename map<Key, T, Compare, Allocator, Policy>::iterator> map<Key, T, Compare, Allocator, Policy>::equal_range(const key_type& k) {
+	return _tree.equal_range_unique(k);
 }
 
 /* <-- ELEMENT ACCESS END */
 
+/* ORDER STATISTICS START --> */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::iterator map<Key, T, Compare, Allocator, Policy>::nth(size_type n) {
+	return _tree.select(n);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::const_iterator map<Key, T, Compare, Allocator, Policy>::nth(size_type n) const {
+	return _tree.select(n);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::size_type map<Key, T, Compare, Allocator, Policy>::rank(const key_type& k) const {
+	return _tree.rank(k);
+}
+
+/* <-- ORDER STATISTICS END */
+
+/* HETEROGENEOUS LOOKUP START --> */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename map<Key, T, Compare, Allocator, Policy>::iterator>::type map<Key, T, Compare, Allocator, Policy>::find(const K& k) {
+	return _tree.find(k);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename map<Key, T, Compare, Allocator, Policy>::const_iterator>::type map<Key, T, Compare, Allocator, Policy>::find(const K& k) const {
+	return _tree.find(k);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename map<Key, T, Compare, Allocator, Policy>::size_type>::type map<Key, T, Compare, Allocator, Policy>::count(const K& k) const {
+	return (_tree.find(k) == end() ? 0 : 1);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename map<Key, T, Compare, Allocator, Policy>::iterator>::type map<Key, T, Compare, Allocator, Policy>::lower_bound(const K& k) {
+	return _tree.lower_bound(k);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename map<Key, T, Compare, Allocator, Policy>::const_iterator>::type map<Key, T, Compare, Allocator, Policy>::lower_bound(const K& k) const {
+	return _tree.lower_bound(k);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename map<Key, T, Compare, Allocator, Policy>::iterator>::type map<Key, T, Compare, Allocator, Policy>::upper_bound(const K& k) {
+	return _tree.upper_bound(k);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename map<Key, T, Compare, Allocator, Policy>::const_iterator>::type map<Key, T, Compare, Allocator, Policy>::upper_bound(const K& k) const {
+	return _tree.upper_bound(k);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename map<Key, T, Compare, Allocator, Policy>::iterator, typename map<Key, T, Compare, Allocator, Policy>::iterator> >::type map<Key, T, Compare, Allocator, Policy>::equal_range(const K& k) {
+	return _tree.equal_range_unique(k);
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename map<Key, T, Compare, Allocator, Policy>::const_iterator, typename map<Key, T, Compare, Allocator, Policy>::const_iterator> >::type map<Key, T, Compare, Allocator, Policy>::equal_range(const K& k) const {
+	return _tree.equal_range_unique(k);
+}
+
+/* <-- HETEROGENEOUS LOOKUP END */
+
 /* ALLOCATOR START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-typename map<Key, T, Compare, Allocator>::allocator_type map<Key, T, Compare, Allocator>::get_allocator() const {
-	return allocator_type();
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+typename map<Key, T, Compare, Allocator, Policy>::allocator_type map<Key, T, Compare, Allocator, Policy>::get_allocator() const {
+	return allocator_type(_tree._alloc);
 }
 
 /* <-- ALLOCATOR END */
 
 /* NON-MEMBER FUNCTION OVERLOADS START --> */
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-bool operator	==	(const map<Key, T, Compare, Allocator>& lhs, const map<Key, T, Compare, Allocator>& rhs) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	==	(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
 	if (lhs.size() != rhs.size())
 		return false;
 	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-bool operator	!=	(const map<Key, T, Compare, Allocator>& lhs, const map<Key, T, Compare, Allocator>& rhs) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	!=	(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
 	return !(lhs == rhs);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-bool operator	<	(const map<Key, T, Compare, Allocator>& lhs, const map<Key, T, Compare, Allocator>& rhs) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	<	(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
 	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-bool operator	<=	(const map<Key, T, Compare, Allocator>& lhs, const map<Key, T, Compare, Allocator>& rhs) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	<=	(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
 	return !(rhs < lhs);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-bool operator	>	(const map<Key, T, Compare, Allocator>& lhs, const map<Key, T, Compare, Allocator>& rhs) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	>	(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
 	return (rhs < lhs);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-bool operator	>=	(const map<Key, T, Compare, Allocator>& lhs, const map<Key, T, Compare, Allocator>& rhs) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	>=	(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
 	return !(lhs < rhs);
 }
 
-template <typename Key, typename T, typename Compare, typename Allocator>
-void swap(map<Key, T, Compare, Allocator>& lhs, map<Key, T, Compare, Allocator>& rhs) {
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+void swap(map<Key, T, Compare, Allocator, Policy>& lhs, map<Key, T, Compare, Allocator, Policy>& rhs) {
 	lhs.swap(rhs);
 }
 
 /* <-- NON-MEMBER FUNCTION OVERLOADS END */
 
+/* SET OPERATIONS START --> */
+
+namespace detail
+{
+
+/* Both maps are walked once in order and the result is laid out bottom-up from the merged sequence, O(n + m).
+   On equal keys the element of lhs is kept, the result takes lhs's comparator and allocator */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy> merge_maps(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs, ft::merge_operation operation) {
+	typedef ft::merge_iterator<typename map<Key, T, Compare, Allocator, Policy>::const_iterator, typename map<Key, T, Compare, Allocator, Policy>::value_compare>	merge_iterator;
+
+	merge_iterator	first(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.value_comp(), operation);
+	merge_iterator	last(lhs.end(), lhs.end(), rhs.end(), rhs.end(), lhs.value_comp(), operation);
+
+	return map<Key, T, Compare, Allocator, Policy>(ft::sorted_unique, first, last, lhs.key_comp(), lhs.get_allocator());
+}
+
+} /* DETAIL NAMESPACE */
+
+/* When one side is much smaller, its keys are looked up in the other one instead, O(m log n):
+   they are appended to an empty result in order, || inserted into || erased from a copy of lhs.
+   The result is initialized once and returned by name, as a map is copied rather than moved */
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy> set_union(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
+	typedef typename map<Key, T, Compare, Allocator, Policy>::const_iterator	const_iterator;
+
+	const bool	lookups = ft::detail::prefer_lookups(rhs.size(), lhs.size());
+	map<Key, T, Compare, Allocator, Policy>	result(lookups ? lhs : ft::detail::merge_maps(lhs, rhs, ft::merge_union));
+
+	if (lookups)
+		for (const_iterator it = rhs.begin(); it != rhs.end(); ++it)
+			result.insert(*it);
+	return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy> set_intersection(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
+	typedef typename map<Key, T, Compare, Allocator, Policy>::const_iterator	const_iterator;
+
+	const bool	lhs_lookups = ft::detail::prefer_lookups(lhs.size(), rhs.size());
+	const bool	rhs_lookups = !lhs_lookups && ft::detail::prefer_lookups(rhs.size(), lhs.size());
+	map<Key, T, Compare, Allocator, Policy>	result(lhs_lookups || rhs_lookups ? map<Key, T, Compare, Allocator, Policy>(lhs.key_comp(), lhs.get_allocator()) : ft::detail::merge_maps(lhs, rhs, ft::merge_intersection));
+	const_iterator	found;
+
+	if (lhs_lookups)
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+			if (rhs.find(it->first) != rhs.end())
+				result.insert(result.end(), *it);
+	if (rhs_lookups)
+		for (const_iterator it = rhs.begin(); it != rhs.end(); ++it)
+			if ((found = lhs.find(it->first)) != lhs.end())
+				result.insert(result.end(), *found);
+	return result;
+}
+
+template <typename Key, typename T, typename Compare, typename Allocator, typename Policy>
+map<Key, T, Compare, Allocator, Policy> set_difference(const map<Key, T, Compare, Allocator, Policy>& lhs, const map<Key, T, Compare, Allocator, Policy>& rhs) {
+	typedef typename map<Key, T, Compare, Allocator, Policy>::const_iterator	const_iterator;
+
+	const bool	lhs_lookups = ft::detail::prefer_lookups(lhs.size(), rhs.size());
+	const bool	rhs_lookups = !lhs_lookups && ft::detail::prefer_lookups(rhs.size(), lhs.size());
+	map<Key, T, Compare, Allocator, Policy>	result(lhs_lookups ? map<Key, T, Compare, Allocator, Policy>(lhs.key_comp(), lhs.get_allocator()) : rhs_lookups ? lhs : ft::detail::merge_maps(lhs, rhs, ft::merge_difference));
+
+	if (lhs_lookups)
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+			if (rhs.find(it->first) == rhs.end())
+				result.insert(result.end(), *it);
+	if (rhs_lookups)
+		for (const_iterator it = rhs.begin(); it != rhs.end(); ++it)
+			result.erase(it->first);
+	return result;
+}
+
+/* <-- SET OPERATIONS END */
+
 
 } /* FT NAMESPACE */
 
@@ -0,0 +1,492 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   multiset.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:51:37 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 23:51:37 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MULTISET_H
+# define MULTISET_H
+
+# include "Additional/less.hpp"
+# include "Additional/equal.hpp"
+# include "Additional/identity.hpp"
+# include "Additional/is_transparent.hpp"
+# include "Additional/order_statistics.hpp"
+# include "Additional/red_black_tree.hpp"
+# include "Additional/lexicographical_compare.hpp"
+
+namespace ft
+{
+
+
+/* ft::set that accepts equal keys, without a hint a new key goes after the keys equal to it */
+
+template <typename T, typename Compare = ft::less<T>, typename Allocator = std::allocator<T>, typename Policy = ft::no_order_statistics>
+class multiset {
+
+public:
+	/* MEMBER TYPES */
+
+	typedef	T																		key_type;
+	typedef	T																		value_type;
+	typedef	Compare																	key_compare;
+	typedef	Compare																	value_compare;
+
+private:
+	typedef typename ft::red_black_tree<value_type, ft::identity<value_type>, key_compare, Allocator, Policy>		tree_type;
+	
+public:
+	typedef typename tree_type::pointer 											pointer;
+	typedef typename tree_type::const_pointer										const_pointer;
+	typedef typename tree_type::reference											reference;
+	typedef typename tree_type::const_reference										const_reference;
+	typedef typename tree_type::iterator											iterator;
+	typedef typename tree_type::const_iterator										const_iterator;
+	typedef typename tree_type::reverse_iterator									reverse_iterator;
+	typedef typename tree_type::const_reverse_iterator								const_reverse_iterator;
+	typedef Allocator																allocator_type;
+	typedef	std::ptrdiff_t															difference_type;
+	typedef	std::size_t																size_type;
+
+	/* ASSIGNMENT */
+
+	explicit multiset (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
+	template <class InputIterator>
+	multiset(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
+	multiset(const multiset& other);
+	~multiset();
+
+	multiset& operator = (const multiset& other);
+
+	/* ITERATORS */
+
+	iterator							begin();
+	iterator							end();
+	const_iterator						begin() const;
+	const_iterator						end() const;
+	reverse_iterator					rbegin();
+	reverse_iterator					rend();
+	const_reverse_iterator				rbegin() const;
+	const_reverse_iterator				rend() const;
+
+	/* CAPACITY */
+
+	bool								empty() const;
+	size_type							size(void) const;
+	size_type							max_size(void) const;
+
+	/* MODIFIERS */
+
+	template <class InputIterator>
+	void								insert(InputIterator first, InputIterator last);
+	iterator							insert(const value_type& val);
+	iterator							insert(iterator position, const value_type& val);
+	void								erase(iterator position);
+	size_type							erase(const key_type& k);
+    void								erase(iterator first, iterator last);
+	void								swap(multiset& x);
+	void								clear(void);
+
+	/* COMPARISON OBJECTS */
+
+	key_compare							key_comp() const;
+	value_compare						value_comp() const;
+
+	/* ELEMENT ACCESS */
+
+	iterator							find(const key_type& k);
+	const_iterator						find(const key_type& k) const;
+	size_type							count(const key_type& k) const;
+	iterator							lower_bound(const key_type& k);
+	const_iterator						lower_bound(const key_type& k) const;
+	iterator							upper_bound(const key_type& k);
+	const_iterator 						upper_bound(const key_type& k) const;
+	pair<const_iterator,const_iterator>	equal_range(const key_type& k) const;
+	pair<iterator,iterator>				equal_range(const key_type& k);
+
+	/* ORDER STATISTICS: only available with ft::order_statistics as Policy */
+
+	iterator							nth(size_type n);
+	const_iterator						nth(size_type n) const;
+	size_type							rank(const key_type& k) const;
+
+	/* HETEROGENEOUS LOOKUP: only available when key_compare declares is_transparent */
+
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									find(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							find(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, size_type>::type									count(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									lower_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							lower_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									upper_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							upper_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<iterator,iterator> >::type					equal_range(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<const_iterator,const_iterator> >::type		equal_range(const K& k) const;
+
+	/* ALLOCATOR */
+
+	allocator_type						get_allocator() const;
+
+	private:
+		tree_type				_tree;
+};
+
+/* CONSTRUCTORS AND DESTRUCTOR START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset (const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) { }
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <class InputIterator>
+multiset<T, Compare, Allocator, Policy>::multiset(InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
+	_tree.insert_equal_range(first, last);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::multiset(const multiset& other) : _tree(other._tree) { }
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>::~multiset() { }
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+multiset<T, Compare, Allocator, Policy>& multiset<T, Compare, Allocator, Policy>::operator = (const multiset& other) {
+	_tree = other._tree;
+	return *this;
+}
+
+/* <-- CONSTRUCTORS AND DESTRUCTOR END */
+
+/* ITERATORS START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::begin() {
+	return _tree.begin();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::end() {
+	return _tree.end();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator multiset<T, Compare, Allocator, Policy>::begin() const {
+	return _tree.begin();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator multiset<T, Compare, Allocator, Policy>::end() const {
+	return _tree.end();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::reverse_iterator multiset<T, Compare, Allocator, Policy>::rbegin() {
+	return _tree.rbegin();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::reverse_iterator multiset<T, Compare, Allocator, Policy>::rend() {
+	return _tree.rend();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_reverse_iterator multiset<T, Compare, Allocator, Policy>::rbegin() const {
+	return _tree.rbegin();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_reverse_iterator multiset<T, Compare, Allocator, Policy>::rend() const {
+	return _tree.rend();
+}
+
+/* <-- ITERATORS END */
+
+/* CAPACITY START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool multiset<T, Compare, Allocator, Policy>::empty() const {
+	return size() ? false : true;
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type multiset<T, Compare, Allocator, Policy>::size(void) const {
+	return _tree.size();
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type multiset<T, Compare, Allocator, Policy>::max_size(void) const {
+	return _tree._alloc.max_size() > __LONG_LONG_MAX__ ? __LONG_LONG_MAX__ : _tree._alloc.max_size();
+}
+
+/* <-- CAPACITY END */
+
+/* MODIFIERS START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <class InputIterator>
+void multiset<T, Compare, Allocator, Policy>::insert(InputIterator first, InputIterator last) {
+	_tree.insert_equal_range(first, last);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::insert(const value_type& val) {
+	return _tree.insert_equal(nullptr, val);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::insert(iterator position, const value_type& val) {
+	return _tree.insert_equal(position._base, val);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::erase(iterator position) {
+	_tree.erase(position._base);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type multiset<T, Compare, Allocator, Policy>::erase(const key_type& k) {
+	ft::pair<iterator, iterator>	range = equal_range(k);
+	size_type						count = 0;
+
+	for (; range.first != range.second; ++count)
+		_tree.erase((range.first++)._base);
+	return count;
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::erase(iterator first, iterator last) {
+
+	/* Erasing a node leaves the other iterators valid, and equal keys must not be erased outside of the range */
+
+	while (first != last)
+		_tree.erase((first++)._base);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::swap(multiset& x) {
+	tree_type	buf = x._tree;
+
+	x._tree = _tree;
+	_tree = buf;
+}
+
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void multiset<T, Compare, Allocator, Policy>::clear(void) {
+	_tree.clear();
+}
+
+/* <-- MODIFIERS END */
+
+/* COMPARISON OBJECTS START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::key_compare multiset<T, Compare, Allocator, Policy>::key_comp(void) const {
+	return _tree._compare;
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::value_compare multiset<T, Compare, Allocator, Policy>::value_comp(void) const {
+	return _tree._compare;
+}
+
+/* <-- COMPARISON OBJECTS END */
+
+/* ELEMENT ACCESS START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::find(const key_type& k) {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator multiset<T, Compare, Allocator, Policy>::find(const key_type& k) const {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type multiset<T, Compare, Allocator, Policy>::count(const key_type& k) const {
+	ft::pair<const_iterator, const_iterator>	range = _tree.equal_range(k);
+
+	return std::distance(range.first, range.second);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::lower_bound(const key_type& k) {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator multiset<T, Compare, Allocator, Policy>::lower_bound(const key_type& k) const {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::upper_bound(const key_type& k) {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator multiset<T, Compare, Allocator, Policy>::upper_bound(const key_type& k) const {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename multiset<T, Compare, Allocator, Policy>::const_iterator, typename multiset<T, Compare, Allocator, Policy>::const_iterator> multiset<T, Compare, Allocator, Policy>::equal_range(const key_type& k) const {
+	return _tree.equal_range(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename multiset<T, Compare, Allocator, Policy>::iterator, typename multiset<T, Compare, Allocator, Policy>::iterator> multiset<T, Compare, Allocator, Policy>::equal_range(const key_type& k) {
+	return _tree.equal_range(k);
+}
+
+/* <-- ELEMENT ACCESS END */
+
+/* ORDER STATISTICS START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::iterator multiset<T, Compare, Allocator, Policy>::nth(size_type n) {
+	return _tree.select(n);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::const_iterator multiset<T, Compare, Allocator, Policy>::nth(size_type n) const {
+	return _tree.select(n);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::size_type multiset<T, Compare, Allocator, Policy>::rank(const key_type& k) const {
+	return _tree.rank(k);
+}
+
+/* <-- ORDER STATISTICS END */
+
+/* HETEROGENEOUS LOOKUP START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename multiset<T, Compare, Allocator, Policy>::iterator>::type multiset<T, Compare, Allocator, Policy>::find(const K& k) {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename multiset<T, Compare, Allocator, Policy>::const_iterator>::type multiset<T, Compare, Allocator, Policy>::find(const K& k) const {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename multiset<T, Compare, Allocator, Policy>::size_type>::type multiset<T, Compare, Allocator, Policy>::count(const K& k) const {
+	ft::pair<const_iterator, const_iterator>	range = _tree.equal_range(k);
+
+	return std::distance(range.first, range.second);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename multiset<T, Compare, Allocator, Policy>::iterator>::type multiset<T, Compare, Allocator, Policy>::lower_bound(const K& k) {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename multiset<T, Compare, Allocator, Policy>::const_iterator>::type multiset<T, Compare, Allocator, Policy>::lower_bound(const K& k) const {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename multiset<T, Compare, Allocator, Policy>::iterator>::type multiset<T, Compare, Allocator, Policy>::upper_bound(const K& k) {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename multiset<T, Compare, Allocator, Policy>::const_iterator>::type multiset<T, Compare, Allocator, Policy>::upper_bound(const K& k) const {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename multiset<T, Compare, Allocator, Policy>::iterator, typename multiset<T, Compare, Allocator, Policy>::iterator> >::type multiset<T, Compare, Allocator, Policy>::equal_range(const K& k) {
+	return _tree.equal_range(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename multiset<T, Compare, Allocator, Policy>::const_iterator, typename multiset<T, Compare, Allocator, Policy>::const_iterator> >::type multiset<T, Compare, Allocator, Policy>::equal_range(const K& k) const {
+	return _tree.equal_range(k);
+}
+
+/* <-- HETEROGENEOUS LOOKUP END */
+
+/* ALLOCATOR START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename multiset<T, Compare, Allocator, Policy>::allocator_type multiset<T, Compare, Allocator, Policy>::get_allocator() const {
+	return allocator_type(_tree._alloc);
+}
+
+/* <-- ALLOCATOR END */
+
+/* NON-MEMBER FUNCTION OVERLOADS START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	==	(const multiset<T, Compare, Allocator, Policy>& lhs, const multiset<T, Compare, Allocator, Policy>& rhs) {
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	!=	(const multiset<T, Compare, Allocator, Policy>& lhs, const multiset<T, Compare, Allocator, Policy>& rhs) {
+	return !(lhs == rhs);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	<	(const multiset<T, Compare, Allocator, Policy>& lhs, const multiset<T, Compare, Allocator, Policy>& rhs) {
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	<=	(const multiset<T, Compare, Allocator, Policy>& lhs, const multiset<T, Compare, Allocator, Policy>& rhs) {
+	return !(rhs < lhs);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	>	(const multiset<T, Compare, Allocator, Policy>& lhs, const multiset<T, Compare, Allocator, Policy>& rhs) {
+	return (rhs < lhs);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	>=	(const multiset<T, Compare, Allocator, Policy>& lhs, const multiset<T, Compare, Allocator, Policy>& rhs) {
+	return !(lhs < rhs);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void swap(multiset<T, Compare, Allocator, Policy>& lhs, multiset<T, Compare, Allocator, Policy>& rhs) {
+	lhs.swap(rhs);
+}
+
+/* <-- NON-MEMBER FUNCTION OVERLOADS END */
+
+
+} /* FT NAMESPACE */
+
+
+#endif /* MULTISET_H */
\ No newline at end of file
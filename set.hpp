@@ -15,14 +15,20 @@
 
 # include "Additional/less.hpp"
 # include "Additional/equal.hpp"
+# include "Additional/identity.hpp"
+# include "Additional/is_transparent.hpp"
+# include "Additional/order_statistics.hpp"
 # include "Additional/red_black_tree.hpp"
+# include "Additional/node_handle.hpp"
+# include "Additional/sorted_unique.hpp"
 # include "Additional/lexicographical_compare.hpp"
+# include "Additional/merge_iterator.hpp"
 
 namespace ft
 {
 
 
-template <typename T, typename Compare = ft::less<T>, typename Allocator = std::allocator<T> >
+template <typename T, typename Compare = ft::less<T>, typename Allocator = std::allocator<T>, typename Policy = ft::no_order_statistics>
 class set {
 
 public:
@@ -34,7 +40,7 @@ public:
 	typedef	Compare																	value_compare;
 
 private:
-	typedef typename ft::red_black_tree<value_type, value_compare, Allocator>		tree_type;
+	typedef typename ft::red_black_tree<value_type, ft::identity<value_type>, key_compare, Allocator, Policy>		tree_type;
 	
 public:
 	typedef typename tree_type::pointer 											pointer;
@@ -48,12 +54,16 @@ public:
 	typedef Allocator																allocator_type;
 	typedef	std::ptrdiff_t															difference_type;
 	typedef	std::size_t																size_type;
+	typedef ft::node_handle<tree_type, key_type>										node_type;
+	typedef ft::insert_return_type<iterator, node_type>									insert_return_type;
 
 	/* ASSIGNMENT */
 
 	explicit set (const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
 	template <class InputIterator>
 	set(InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
+	template <class InputIterator>
+	set(ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type());
 	set(const set& other);
 	~set();
 
@@ -82,11 +92,21 @@ public:
 	void								insert(InputIterator first, InputIterator last);
 	pair<iterator,bool>					insert(const value_type& val);
 	iterator							insert(iterator position, const value_type& val);
+# if __cplusplus >= 201103L
+	insert_return_type					insert(node_type&& nh);
+# else
+	insert_return_type					insert(const node_type& nh);
+# endif
+	node_type							extract(iterator position);
+	node_type							extract(const key_type& k);
 	void								erase(iterator position);
 	size_type							erase(const key_type& k);
     void								erase(iterator first, iterator last);
 	void								swap(set& x);
 	void								clear(void);
+	set								split_at(const key_type& k);
+	void								split_at(const key_type& k, set& greater);
+	void								merge_disjoint(set& other);
 
 	/* COMPARISON OBJECTS */
 
@@ -105,6 +125,33 @@ public:
 	pair<const_iterator,const_iterator>	equal_range(const key_type& k) const;
 	pair<iterator,iterator>				equal_range(const key_type& k);
 
+	/* ORDER STATISTICS: only available with ft::order_statistics as Policy */
+
+	iterator							nth(size_type n);
+	const_iterator						nth(size_type n) const;
+	size_type							rank(const key_type& k) const;
+
+	/* HETEROGENEOUS LOOKUP: only available when key_compare declares is_transparent */
+
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									find(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							find(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, size_type>::type									count(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									lower_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							lower_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, iterator>::type									upper_bound(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, const_iterator>::type							upper_bound(const K& k) const;
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<iterator,iterator> >::type					equal_range(const K& k);
+	template <typename K>
+	typename ft::enable_if_transparent<Compare, K, pair<const_iterator,const_iterator> >::type		equal_range(const K& k) const;
+
 	/* ALLOCATOR */
 
 	allocator_type						get_allocator() const;
@@ -115,27 +162,29 @@ public:
 
 /* CONSTRUCTORS AND DESTRUCTOR START --> */
 
-template <typename T, typename Compare, typename Allocator>
-set<T, Compare, Allocator>::set (const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) { }
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy>::set (const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) { }
 
-template <typename T, typename Compare, typename Allocator>
+template <typename T, typename Compare, typename Allocator, typename Policy>
 template <class InputIterator>
-set<T, Compare, Allocator>::set(InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
-	for (; first != last; ++first)
-		_tree.insert(nullptr, *first);
+set<T, Compare, Allocator, Policy>::set(InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
+	_tree.insert_range(first, last);
 }
 
-template <typename T, typename Compare, typename Allocator>
-set<T, Compare, Allocator>::set(const set& other) : _tree(other._tree._compare, other._tree._alloc) {
-	for (const_iterator it1 = other.begin(), it2 = other.end(); it1 != it2; ++it1)
-		_tree.insert(nullptr, *it1);
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <class InputIterator>
+set<T, Compare, Allocator, Policy>::set(ft::sorted_unique_t, InputIterator first, InputIterator last, const key_compare& comp, const allocator_type& alloc) : _tree(comp, alloc) {
+	_tree.insert_sorted(first, last);
 }
 
-template <typename T, typename Compare, typename Allocator>
-set<T, Compare, Allocator>::~set() { }
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy>::set(const set& other) : _tree(other._tree) { }
 
-template <typename T, typename Compare, typename Allocator>
-set<T, Compare, Allocator>& set<T, Compare, Allocator>::operator = (const set& other) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy>::~set() { }
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy>& set<T, Compare, Allocator, Policy>::operator = (const set& other) {
 	_tree = other._tree;
 	return *this;
 }
@@ -144,43 +193,43 @@ set<T, Compare, Allocator>& set<T, Compare, Allocator>::operator = (const set& o
 
 /* ITERATORS START --> */
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::begin() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::iterator set<T, Compare, Allocator, Policy>::begin() {
 	return _tree.begin();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::end() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::iterator set<T, Compare, Allocator, Policy>::end() {
 	return _tree.end();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::const_iterator set<T, Compare, Allocator>::begin() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_iterator set<T, Compare, Allocator, Policy>::begin() const {
 	return _tree.begin();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::const_iterator set<T, Compare, Allocator>::end() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_iterator set<T, Compare, Allocator, Policy>::end() const {
 	return _tree.end();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::reverse_iterator set<T, Compare, Allocator>::rbegin() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::reverse_iterator set<T, Compare, Allocator, Policy>::rbegin() {
 	return _tree.rbegin();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::reverse_iterator set<T, Compare, Allocator>::rend() {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::reverse_iterator set<T, Compare, Allocator, Policy>::rend() {
 	return _tree.rend();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::const_reverse_iterator set<T, Compare, Allocator>::rbegin() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_reverse_iterator set<T, Compare, Allocator, Policy>::rbegin() const {
 	return _tree.rbegin();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::const_reverse_iterator set<T, Compare, Allocator>::rend() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_reverse_iterator set<T, Compare, Allocator, Policy>::rend() const {
 	return _tree.rend();
 }
 
@@ -188,18 +237,18 @@ typename set<T, Compare, Allocator>::const_reverse_iterator set<T, Compare, Allo
 
 /* CAPACITY START --> */
 
-template <typename T, typename Compare, typename Allocator>
-bool set<T, Compare, Allocator>::empty() const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool set<T, Compare, Allocator, Policy>::empty() const {
 	return size() ? false : true;
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::size_type set<T, Compare, Allocator>::size(void) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::size_type set<T, Compare, Allocator, Policy>::size(void) const {
 	return _tree.size();
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::size_type set<T, Compare, Allocator>::max_size(void) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::size_type set<T, Compare, Allocator, Policy>::max_size(void) const {
 	return _tree._alloc.max_size() > __LONG_LONG_MAX__ ? __LONG_LONG_MAX__ : _tree._alloc.max_size();
 }
 
@@ -207,30 +256,70 @@ typename set<T, Compare, Allocator>::size_type set<T, Compare, Allocator>::max_s
 
 /* MODIFIERS START --> */
 
-template <typename T, typename Compare, typename Allocator>
+template <typename T, typename Compare, typename Allocator, typename Policy>
 template <class InputIterator>
-void set<T, Compare, Allocator>::insert(InputIterator first, InputIterator last) {
-	for (; first != last; ++first)
-		_tree.insert(nullptr, *first);
+void set<T, Compare, Allocator, Policy>::insert(InputIterator first, InputIterator last) {
+	_tree.insert_range(first, last);
 }
 
-template <typename T, typename Compare, typename Allocator>
-ft::pair<typename set<T, Compare, Allocator>::iterator, bool> set<T, Compare, Allocator>::insert(const value_type& val) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename set<T, Compare, Allocator, Policy>::iterator, bool> set<T, Compare, Allocator, Policy>::insert(const value_type& val) {
 	return _tree.insert(nullptr, val);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::insert(iterator position, const value_type& val) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::iterator set<T, Compare, Allocator, Policy>::insert(iterator position, const value_type& val) {
 	return _tree.insert(position._base, val).first;
 }
 
-template <typename T, typename Compare, typename Allocator>
-void set<T, Compare, Allocator>::erase(iterator position) {
+/* The handle's node is relinked as is, its allocator must compare equal to the set's. If the key is already there it stays in the handle */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+# if __cplusplus >= 201103L
+typename set<T, Compare, Allocator, Policy>::insert_return_type set<T, Compare, Allocator, Policy>::insert(node_type&& nh) {
+# else
+typename set<T, Compare, Allocator, Policy>::insert_return_type set<T, Compare, Allocator, Policy>::insert(const node_type& nh) {
+# endif
+	insert_return_type			result;
+	ft::pair<iterator, bool>	inserted;
+
+	result.position = end();
+	result.inserted = false;
+	if (nh.empty())
+		return result;
+	inserted = _tree.insert_node(nh._node);
+	result.position = inserted.first;
+	result.inserted = inserted.second;
+	if (inserted.second)
+		nh.release();
+	else
+# if __cplusplus >= 201103L
+		result.node = std::move(nh);
+# else
+		result.node = nh;
+# endif
+	return result;
+}
+
+/* The node leaves the tree without being copied || freed */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::node_type set<T, Compare, Allocator, Policy>::extract(iterator position) {
+	return node_type(_tree.extract(position), _tree._alloc);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::node_type set<T, Compare, Allocator, Policy>::extract(const key_type& k) {
+	return extract(find(k));
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void set<T, Compare, Allocator, Policy>::erase(iterator position) {
 	_tree.erase(position._base);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::size_type set<T, Compare, Allocator>::erase(const key_type& k) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::size_type set<T, Compare, Allocator, Policy>::erase(const key_type& k) {
 	iterator	it = find(k);
 
 	if (it != end()) {
@@ -240,8 +329,8 @@ typename set<T, Compare, Allocator>::size_type set<T, Compare, Allocator>::erase
 	return 0;
 }
 
-template <typename T, typename Compare, typename Allocator>
-void set<T, Compare, Allocator>::erase(iterator first, iterator last) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void set<T, Compare, Allocator, Policy>::erase(iterator first, iterator last) {
 	size_type	arr_size = std::distance(first, last);
 	key_type*	array = new key_type [arr_size];
 
@@ -254,8 +343,8 @@ void set<T, Compare, Allocator>::erase(iterator first, iterator last) {
 	delete [] array;
 }
 
-template <typename T, typename Compare, typename Allocator>
-void set<T, Compare, Allocator>::swap(set& x) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void set<T, Compare, Allocator, Policy>::swap(set& x) {
 	tree_type	buf = x._tree;
 
 	x._tree = _tree;
@@ -263,126 +352,316 @@ void set<T, Compare, Allocator>::swap(set& x) {
 }
 
 
-template <typename T, typename Compare, typename Allocator>
-void set<T, Compare, Allocator>::clear(void) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void set<T, Compare, Allocator, Policy>::clear(void) {
 	_tree.clear();
 }
 
+/* The elements not less than k are moved to the returned set: O(log n), the nodes are relinked, not copied */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy> set<T, Compare, Allocator, Policy>::split_at(const key_type& k) {
+	set	greater(key_comp(), get_allocator());
+
+	split_at(k, greater);
+	return greater;
+}
+
+/* Same, into an existing set whose elements are dropped ==> no copy on assignment. Its allocator must compare
+   equal to this set's for the nodes to be relinked, they are copied otherwise */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void set<T, Compare, Allocator, Policy>::split_at(const key_type& k, set& greater) {
+	if (this != &greater)
+		_tree.split(k, greater._tree);
+}
+
+/* All of other's keys after || before this set's ones ==> its nodes are relinked in O(log n), || copied when
+   the allocators differ. Otherwise the elements are moved one by one, the ones whose key is already here stay in other */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void set<T, Compare, Allocator, Policy>::merge_disjoint(set& other) {
+	iterator	it;
+
+	if (this == &other || _tree.join(other._tree))
+		return ;
+	for (it = other.begin(); it != other.end(); ) {
+		if (insert(*it).second)
+			other.erase(it++);
+		else
+			++it;
+	}
+}
+
 /* <-- MODIFIERS END */
 
 /* COMPARISON OBJECTS START --> */
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::key_compare set<T, Compare, Allocator>::key_comp(void) const {
-	return key_compare();	
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::key_compare set<T, Compare, Allocator, Policy>::key_comp(void) const {
+	return _tree._compare;
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::value_compare set<T, Compare, Allocator>::value_comp(void) const {
-	return value_compare();
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::value_compare set<T, Compare, Allocator, Policy>::value_comp(void) const {
+	return _tree._compare;
 }
 
 /* <-- COMPARISON OBJECTS END */
 
 /* ELEMENT ACCESS START --> */
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::find(const key_type& k) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::iterator set<T, Compare, Allocator, Policy>::find(const key_type& k) {
 	return _tree.find(k);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::const_iterator set<T, Compare, Allocator>::find(const key_type& k) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_iterator set<T, Compare, Allocator, Policy>::find(const key_type& k) const {
 	return _tree.find(k);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::size_type set<T, Compare, Allocator>::count(const key_type& k) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::size_type set<T, Compare, Allocator, Policy>::count(const key_type& k) const {
 	return (_tree.find(k) == end() ? 0 : 1);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::lower_bound(const key_type& k) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::iterator set<T, Compare, Allocator, Policy>::lower_bound(const key_type& k) {
 	return _tree.lower_bound(k);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::const_iterator set<T, Compare, Allocator>::lower_bound(const key_type& k) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_iterator set<T, Compare, Allocator, Policy>::lower_bound(const key_type& k) const {
 	return _tree.lower_bound(k);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::iterator set<T, Compare, Allocator>::upper_bound(const key_type& k) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::iterator set<T, Compare, Allocator, Policy>::upper_bound(const key_type& k) {
 	return _tree.upper_bound(k);
 }
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::const_iterator set<T, Compare, Allocator>::upper_bound(const key_type& k) const {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_iterator set<T, Compare, Allocator, Policy>::upper_bound(const key_type& k) const {
 	return _tree.upper_bound(k);
 }
 
-template <typename T, typename Compare, typename Allocator>
-ft::pair<typename set<T, Compare, Allocator>::const_iterator, typename set<T, Compare, Allocator>::const_iterator> set<T, Compare, Allocator>::equal_range(const key_type& k) const {
-	return ft::make_pair(lower_bound(k), upper_bound(k));
-};
+template <typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename set<T, Compare, Allocator, Policy>::const_iterator, typename set<T, Compare, Allocator, Policy>::const_iterator> set<T, Compare, Allocator, Policy>::equal_range(const key_type& k) const {
+	return _tree.equal_range_unique(k);
+}
 
-template <typename T, typename Compare, typename Allocator>
-ft::pair<typename set<T, Compare, Allocator>::iterator, typename set<T, Compare, Allocator>::iterator> set<T, Compare, Allocator>::equal_range(const key_type& k) {
-	return ft::make_pair(lower_bound(k), upper_bound(k));
+template <typename T, typename Compare, typename Allocator, typename Policy>
+ft::pair<typename set<T, Compare, Allocator, Policy>::iterator, typename set<T, Compare, Allocator, Policy>::iterator> set<T, Compare, Allocator, Policy>::equal_range(const key_type& k) {
+	return _tree.equal_range_unique(k);
 }
 
 /* <-- ELEMENT ACCESS END */
 
+/* ORDER STATISTICS START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::iterator set<T, Compare, Allocator, Policy>::nth(size_type n) {
+	return _tree.select(n);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::const_iterator set<T, Compare, Allocator, Policy>::nth(size_type n) const {
+	return _tree.select(n);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::size_type set<T, Compare, Allocator, Policy>::rank(const key_type& k) const {
+	return _tree.rank(k);
+}
+
+/* <-- ORDER STATISTICS END */
+
+/* HETEROGENEOUS LOOKUP START --> */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename set<T, Compare, Allocator, Policy>::iterator>::type set<T, Compare, Allocator, Policy>::find(const K& k) {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename set<T, Compare, Allocator, Policy>::const_iterator>::type set<T, Compare, Allocator, Policy>::find(const K& k) const {
+	return _tree.find(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename set<T, Compare, Allocator, Policy>::size_type>::type set<T, Compare, Allocator, Policy>::count(const K& k) const {
+	return (_tree.find(k) == end() ? 0 : 1);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename set<T, Compare, Allocator, Policy>::iterator>::type set<T, Compare, Allocator, Policy>::lower_bound(const K& k) {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename set<T, Compare, Allocator, Policy>::const_iterator>::type set<T, Compare, Allocator, Policy>::lower_bound(const K& k) const {
+	return _tree.lower_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename set<T, Compare, Allocator, Policy>::iterator>::type set<T, Compare, Allocator, Policy>::upper_bound(const K& k) {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, typename set<T, Compare, Allocator, Policy>::const_iterator>::type set<T, Compare, Allocator, Policy>::upper_bound(const K& k) const {
+	return _tree.upper_bound(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename set<T, Compare, Allocator, Policy>::iterator, typename set<T, Compare, Allocator, Policy>::iterator> >::type set<T, Compare, Allocator, Policy>::equal_range(const K& k) {
+	return _tree.equal_range_unique(k);
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+template <typename K>
+typename ft::enable_if_transparent<Compare, K, ft::pair<typename set<T, Compare, Allocator, Policy>::const_iterator, typename set<T, Compare, Allocator, Policy>::const_iterator> >::type set<T, Compare, Allocator, Policy>::equal_range(const K& k) const {
+	return _tree.equal_range_unique(k);
+}
+
+/* <-- HETEROGENEOUS LOOKUP END */
+
 /* ALLOCATOR START --> */
 
-template <typename T, typename Compare, typename Allocator>
-typename set<T, Compare, Allocator>::allocator_type set<T, Compare, Allocator>::get_allocator() const {
-	return allocator_type();
+template <typename T, typename Compare, typename Allocator, typename Policy>
+typename set<T, Compare, Allocator, Policy>::allocator_type set<T, Compare, Allocator, Policy>::get_allocator() const {
+	return allocator_type(_tree._alloc);
 }
 
 /* <-- ALLOCATOR END */
 
 /* NON-MEMBER FUNCTION OVERLOADS START --> */
 
-template <typename T, typename Compare, typename Allocator>
-bool operator	==	(const set<T, Compare, Allocator>& lhs, const set<T, Compare, Allocator>& rhs) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	==	(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
 	if (lhs.size() != rhs.size())
 		return false;
 	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename T, typename Compare, typename Allocator>
-bool operator	!=	(const set<T, Compare, Allocator>& lhs, const set<T, Compare, Allocator>& rhs) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	!=	(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
 	return !(lhs == rhs);
 }
 
-template <typename T, typename Compare, typename Allocator>
-bool operator	<	(const set<T, Compare, Allocator>& lhs, const set<T, Compare, Allocator>& rhs) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	<	(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
 	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <typename T, typename Compare, typename Allocator>
-bool operator	<=	(const set<T, Compare, Allocator>& lhs, const set<T, Compare, Allocator>& rhs) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	<=	(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
 	return !(rhs < lhs);
 }
 
-template <typename T, typename Compare, typename Allocator>
-bool operator	>	(const set<T, Compare, Allocator>& lhs, const set<T, Compare, Allocator>& rhs) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	>	(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
 	return (rhs < lhs);
 }
 
-template <typename T, typename Compare, typename Allocator>
-bool operator	>=	(const set<T, Compare, Allocator>& lhs, const set<T, Compare, Allocator>& rhs) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+bool operator	>=	(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
 	return !(lhs < rhs);
 }
 
-template <typename T, typename Compare, typename Allocator>
-void swap(set<T, Compare, Allocator>& lhs, set<T, Compare, Allocator>& rhs) {
+template <typename T, typename Compare, typename Allocator, typename Policy>
+void swap(set<T, Compare, Allocator, Policy>& lhs, set<T, Compare, Allocator, Policy>& rhs) {
 	lhs.swap(rhs);
 }
 
 /* <-- NON-MEMBER FUNCTION OVERLOADS END */
 
+/* SET OPERATIONS START --> */
+
+namespace detail
+{
+
+/* Both sets are walked once in order and the result is laid out bottom-up from the merged sequence, O(n + m).
+   The result takes lhs's comparator and allocator */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy> merge_sets(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs, ft::merge_operation operation) {
+	typedef ft::merge_iterator<typename set<T, Compare, Allocator, Policy>::const_iterator, Compare>	merge_iterator;
+
+	merge_iterator	first(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), lhs.value_comp(), operation);
+	merge_iterator	last(lhs.end(), lhs.end(), rhs.end(), rhs.end(), lhs.value_comp(), operation);
+
+	return set<T, Compare, Allocator, Policy>(ft::sorted_unique, first, last, lhs.key_comp(), lhs.get_allocator());
+}
+
+} /* DETAIL NAMESPACE */
+
+/* When one side is much smaller, its elements are looked up in the other one instead, O(m log n):
+   they are appended to an empty result in order, || inserted into || erased from a copy of lhs.
+   The result is initialized once and returned by name, as a set is copied rather than moved */
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy> set_union(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
+	typedef typename set<T, Compare, Allocator, Policy>::const_iterator	const_iterator;
+
+	const bool	lookups = ft::detail::prefer_lookups(rhs.size(), lhs.size());
+	set<T, Compare, Allocator, Policy>	result(lookups ? lhs : ft::detail::merge_sets(lhs, rhs, ft::merge_union));
+
+	if (lookups)
+		for (const_iterator it = rhs.begin(); it != rhs.end(); ++it)
+			result.insert(*it);
+	return result;
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy> set_intersection(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
+	typedef typename set<T, Compare, Allocator, Policy>::const_iterator	const_iterator;
+
+	const bool	lhs_lookups = ft::detail::prefer_lookups(lhs.size(), rhs.size());
+	const bool	rhs_lookups = !lhs_lookups && ft::detail::prefer_lookups(rhs.size(), lhs.size());
+	set<T, Compare, Allocator, Policy>	result(lhs_lookups || rhs_lookups ? set<T, Compare, Allocator, Policy>(lhs.key_comp(), lhs.get_allocator()) : ft::detail::merge_sets(lhs, rhs, ft::merge_intersection));
+	const_iterator	found;
+
+	if (lhs_lookups)
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+			if (rhs.find(*it) != rhs.end())
+				result.insert(result.end(), *it);
+	if (rhs_lookups)
+		for (const_iterator it = rhs.begin(); it != rhs.end(); ++it)
+			if ((found = lhs.find(*it)) != lhs.end())
+				result.insert(result.end(), *found);
+	return result;
+}
+
+template <typename T, typename Compare, typename Allocator, typename Policy>
+set<T, Compare, Allocator, Policy> set_difference(const set<T, Compare, Allocator, Policy>& lhs, const set<T, Compare, Allocator, Policy>& rhs) {
+	typedef typename set<T, Compare, Allocator, Policy>::const_iterator	const_iterator;
+
+	const bool	lhs_lookups = ft::detail::prefer_lookups(lhs.size(), rhs.size());
+	const bool	rhs_lookups = !lhs_lookups && ft::detail::prefer_lookups(rhs.size(), lhs.size());
+	set<T, Compare, Allocator, Policy>	result(lhs_lookups ? set<T, Compare, Allocator, Policy>(lhs.key_comp(), lhs.get_allocator()) : rhs_lookups ? lhs : ft::detail::merge_sets(lhs, rhs, ft::merge_difference));
+
+	if (lhs_lookups)
+		for (const_iterator it = lhs.begin(); it != lhs.end(); ++it)
+			if (rhs.find(*it) == rhs.end())
+				result.insert(result.end(), *it);
+	if (rhs_lookups)
+		for (const_iterator it = rhs.begin(); it != rhs.end(); ++it)
+			result.erase(*it);
+	return result;
+}
+
+/* <-- SET OPERATIONS END */
+
 
 } /* FT NAMESPACE */
 
@@ -0,0 +1,405 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ncarob <ncarob@student.42.fr>              +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 13:41:52 by ncarob            #+#    #+#             */
+/*   Updated: 2026/10/17 13:41:52 by ncarob           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SMALL_VECTOR_H
+# define SMALL_VECTOR_H
+
+# include "vector.hpp"
+
+namespace ft
+{
+
+/* Allocator handed to the underlying vector: requests of up to N elements are served from a buffer that lives
+   inside the small_vector, everything else goes to Allocator. The buffer is handed over once, by the allocator
+   small_vector builds to the copy its vector keeps: any other copy, e.g. get_allocator()'s, has no buffer. */
+
+template <typename T, std::size_t N, typename Allocator = std::allocator<T> >
+class small_buffer_allocator : public Allocator {
+
+public:
+	typedef typename Allocator::pointer		pointer;
+	typedef typename Allocator::size_type	size_type;
+
+	explicit small_buffer_allocator(pointer buffer = nullptr, const Allocator& alloc = Allocator());
+	small_buffer_allocator(const small_buffer_allocator& other);
+	~small_buffer_allocator();
+
+	small_buffer_allocator&	operator = (const small_buffer_allocator& other);
+
+	pointer	allocate(size_type n);
+	void	deallocate(pointer p, size_type n);
+
+private:
+	pointer			_buffer;
+	bool			_buffer_in_use;
+	mutable bool	_hand_over;
+};
+
+/* A vector that keeps up to N elements inline and only spills to the heap beyond that */
+
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>, typename GrowthPolicy = ft::geometric_growth<2, 1> >
+class small_vector : private vector<T, small_buffer_allocator<T, N, Allocator>, GrowthPolicy> {
+
+public:
+	/* MEMBER TYPES */
+
+	typedef vector<T, small_buffer_allocator<T, N, Allocator>, GrowthPolicy>	vector_type;
+	typedef typename vector_type::value_type									value_type;
+	typedef typename vector_type::pointer										pointer;
+	typedef typename vector_type::const_pointer									const_pointer;
+	typedef typename vector_type::reference										reference;
+	typedef typename vector_type::const_reference								const_reference;
+	typedef typename vector_type::difference_type								difference_type;
+	typedef typename vector_type::size_type										size_type;
+	typedef typename vector_type::iterator										iterator;
+	typedef typename vector_type::const_iterator								const_iterator;
+	typedef typename vector_type::reverse_iterator								reverse_iterator;
+	typedef typename vector_type::const_reverse_iterator						const_reverse_iterator;
+	typedef typename vector_type::allocator_type								buffer_allocator_type;
+	typedef Allocator															allocator_type;
+
+	const static size_type	inline_capacity = N;
+
+	/* CONSTRUCTORS DESTRUCTORS + ASSIGNMENT OPERATOR */
+
+	explicit small_vector(const allocator_type& alloc = allocator_type());
+	explicit small_vector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type());
+	template <typename InputIterator>
+	small_vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type());
+	small_vector(const small_vector& other);
+	~small_vector();
+
+	small_vector&	operator = (const small_vector& other);
+
+	/* The vector's interface, but for what would hand the inline buffer to another object: the vector base
+	   is private, so a small_vector can't be copied, assigned || swapped as a vector */
+
+	using vector_type::begin;
+	using vector_type::end;
+	using vector_type::rbegin;
+	using vector_type::rend;
+	using vector_type::size;
+	using vector_type::max_size;
+	using vector_type::resize;
+	using vector_type::capacity;
+	using vector_type::empty;
+	using vector_type::reserve;
+	using vector_type::operator[];
+	using vector_type::at;
+	using vector_type::front;
+	using vector_type::back;
+	using vector_type::data;
+	using vector_type::assign;
+	using vector_type::push_back;
+	using vector_type::emplace_back;
+	using vector_type::emplace;
+	using vector_type::pop_back;
+	using vector_type::insert;
+	using vector_type::erase;
+	using vector_type::clear;
+
+	/* CAPACITY */
+
+	bool	is_inline(void) const;
+	void	shrink_to_fit(void);
+
+	/* MODIFIERS */
+
+	void	swap(small_vector& other);
+
+	/* ALLOCATOR */
+
+	allocator_type	get_allocator(void) const;
+
+	/* NON-MEMBER FUNCTION OVERLOADS: the vector's comparisons, reached through the private base */
+
+	template <typename Y, std::size_t M, typename Alloc, typename Growth>
+	friend bool	operator == (const small_vector<Y, M, Alloc, Growth>& lhs, const small_vector<Y, M, Alloc, Growth>& rhs);
+	template <typename Y, std::size_t M, typename Alloc, typename Growth>
+	friend bool	operator != (const small_vector<Y, M, Alloc, Growth>& lhs, const small_vector<Y, M, Alloc, Growth>& rhs);
+	template <typename Y, std::size_t M, typename Alloc, typename Growth>
+	friend bool	operator < (const small_vector<Y, M, Alloc, Growth>& lhs, const small_vector<Y, M, Alloc, Growth>& rhs);
+	template <typename Y, std::size_t M, typename Alloc, typename Growth>
+	friend bool	operator <= (const small_vector<Y, M, Alloc, Growth>& lhs, const small_vector<Y, M, Alloc, Growth>& rhs);
+	template <typename Y, std::size_t M, typename Alloc, typename Growth>
+	friend bool	operator > (const small_vector<Y, M, Alloc, Growth>& lhs, const small_vector<Y, M, Alloc, Growth>& rhs);
+	template <typename Y, std::size_t M, typename Alloc, typename Growth>
+	friend bool	operator >= (const small_vector<Y, M, Alloc, Growth>& lhs, const small_vector<Y, M, Alloc, Growth>& rhs);
+
+private:
+	/* ATTRIBUTES */
+
+	/* N == 0 would give a zero-length inline buffer ==> rejected at compile time, a plain vector fits that case */
+	typedef char	inline_capacity_must_be_positive[N > 0 ? 1 : -1];
+
+	union storage {
+		char		bytes[N * sizeof (T)];
+		long double	align_float;
+		long long	align_int;
+		void*		align_pointer;
+	};
+
+	storage	_storage;
+
+	pointer	_inline_buffer(void);
+	void	_swap_inline(small_vector& other);
+	void	_swap_spilled(small_vector& spilled);
+};
+
+/* SMALL BUFFER ALLOCATOR START --> */
+
+template <typename T, std::size_t N, typename Allocator>
+small_buffer_allocator<T, N, Allocator>::small_buffer_allocator(pointer buffer, const Allocator& alloc) : Allocator(alloc), _buffer(buffer), _buffer_in_use(false), _hand_over(buffer != nullptr) {}
+
+template <typename T, std::size_t N, typename Allocator>
+small_buffer_allocator<T, N, Allocator>::small_buffer_allocator(const small_buffer_allocator& other) : Allocator(other), _buffer(other._hand_over ? other._buffer : nullptr), _buffer_in_use(false), _hand_over(false) {
+	other._hand_over = false;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+small_buffer_allocator<T, N, Allocator>::~small_buffer_allocator() {}
+
+template <typename T, std::size_t N, typename Allocator>
+small_buffer_allocator<T, N, Allocator>&	small_buffer_allocator<T, N, Allocator>::operator = (const small_buffer_allocator& other) {
+	/* The buffer belongs to the owning small_vector ==> only the underlying allocator is assigned */
+
+	Allocator::operator=(other);
+	return *this;
+}
+
+template <typename T, std::size_t N, typename Allocator>
+typename small_buffer_allocator<T, N, Allocator>::pointer small_buffer_allocator<T, N, Allocator>::allocate(size_type n) {
+	if (_buffer && !_buffer_in_use && n <= N) {
+		_buffer_in_use = true;
+		return _buffer;
+	}
+	return Allocator::allocate(n);
+}
+
+template <typename T, std::size_t N, typename Allocator>
+void small_buffer_allocator<T, N, Allocator>::deallocate(pointer p, size_type n) {
+	if (p == _buffer)
+		_buffer_in_use = false;
+	else
+		Allocator::deallocate(p, n);
+}
+
+/* <-- SMALL BUFFER ALLOCATOR END */
+
+/* CONSTRUCTORS AND DESTRUCTOR START --> */
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+small_vector<T, N, Allocator, GrowthPolicy>::small_vector(const allocator_type& alloc) : vector_type(buffer_allocator_type(_inline_buffer(), alloc)) {
+	vector_type::reserve(N);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+small_vector<T, N, Allocator, GrowthPolicy>::small_vector(size_type n, const value_type& val, const allocator_type& alloc) : vector_type(buffer_allocator_type(_inline_buffer(), alloc)) {
+	vector_type::reserve(N);
+	vector_type::assign(n, val);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+template <typename InputIterator>
+small_vector<T, N, Allocator, GrowthPolicy>::small_vector(InputIterator first, InputIterator last, const allocator_type& alloc) : vector_type(buffer_allocator_type(_inline_buffer(), alloc)) {
+	vector_type::reserve(N);
+	vector_type::assign(first, last);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+small_vector<T, N, Allocator, GrowthPolicy>::small_vector(const small_vector& other) : vector_type(buffer_allocator_type(_inline_buffer(), other.get_allocator())) {
+	vector_type::reserve(N);
+	vector_type::assign(other.begin(), other.end());
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+small_vector<T, N, Allocator, GrowthPolicy>::~small_vector() {}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+small_vector<T, N, Allocator, GrowthPolicy>&	small_vector<T, N, Allocator, GrowthPolicy>::operator = (const small_vector& other) {
+	if (this != &other)
+		vector_type::assign(other.begin(), other.end());
+	return *this;
+}
+
+/* <-- CONSTRUCTORS AND DESTRUCTOR END */
+
+/* CAPACITY START --> */
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+bool small_vector<T, N, Allocator, GrowthPolicy>::is_inline(void) const {
+	return vector_type::data() == reinterpret_cast<const value_type*>(_storage.bytes);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+void small_vector<T, N, Allocator, GrowthPolicy>::shrink_to_fit(void) {
+	/* Inline storage cannot shrink, spilled storage moves back inline once the elements fit */
+
+	if (is_inline())
+		return ;
+	if (vector_type::size() > N)
+		vector_type::shrink_to_fit();
+	else {
+		small_vector	copy(*this);
+
+		vector_type::clear();
+		vector_type::shrink_to_fit();
+		vector_type::reserve(N);
+		vector_type::assign(copy.begin(), copy.end());
+	}
+}
+
+/* <-- CAPACITY END */
+
+/* MODIFIERS START --> */
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+void small_vector<T, N, Allocator, GrowthPolicy>::swap(small_vector& other) {
+	/* Heap storage changes owner by swapping pointers, inline elements are the only ones copied */
+
+	if (this == &other)
+		return ;
+	if (!is_inline() && !other.is_inline())
+		vector_type::swap(other);
+	else if (is_inline() && other.is_inline())
+		_swap_inline(other);
+	else if (is_inline())
+		_swap_spilled(other);
+	else
+		other._swap_spilled(*this);
+}
+
+/* <-- MODIFIERS END */
+
+/* ALLOCATOR START --> */
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+typename small_vector<T, N, Allocator, GrowthPolicy>::allocator_type small_vector<T, N, Allocator, GrowthPolicy>::get_allocator(void) const {
+	return allocator_type(vector_type::get_allocator());
+}
+
+/* <-- ALLOCATOR END */
+
+/* NON-MEMBER FUNCTION OVERLOADS START --> */
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+bool operator	==	(const small_vector<T, N, Allocator, GrowthPolicy>& lhs, const small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+	typedef typename small_vector<T, N, Allocator, GrowthPolicy>::vector_type	vector_type;
+
+	return static_cast<const vector_type&>(lhs) == static_cast<const vector_type&>(rhs);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+bool operator	!=	(const small_vector<T, N, Allocator, GrowthPolicy>& lhs, const small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+	typedef typename small_vector<T, N, Allocator, GrowthPolicy>::vector_type	vector_type;
+
+	return static_cast<const vector_type&>(lhs) != static_cast<const vector_type&>(rhs);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+bool operator	<	(const small_vector<T, N, Allocator, GrowthPolicy>& lhs, const small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+	typedef typename small_vector<T, N, Allocator, GrowthPolicy>::vector_type	vector_type;
+
+	return static_cast<const vector_type&>(lhs) < static_cast<const vector_type&>(rhs);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+bool operator	<=	(const small_vector<T, N, Allocator, GrowthPolicy>& lhs, const small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+	typedef typename small_vector<T, N, Allocator, GrowthPolicy>::vector_type	vector_type;
+
+	return static_cast<const vector_type&>(lhs) <= static_cast<const vector_type&>(rhs);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+bool operator	>	(const small_vector<T, N, Allocator, GrowthPolicy>& lhs, const small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+	typedef typename small_vector<T, N, Allocator, GrowthPolicy>::vector_type	vector_type;
+
+	return static_cast<const vector_type&>(lhs) > static_cast<const vector_type&>(rhs);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+bool operator	>=	(const small_vector<T, N, Allocator, GrowthPolicy>& lhs, const small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+	typedef typename small_vector<T, N, Allocator, GrowthPolicy>::vector_type	vector_type;
+
+	return static_cast<const vector_type&>(lhs) >= static_cast<const vector_type&>(rhs);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+void swap(small_vector<T, N, Allocator, GrowthPolicy>& lhs, small_vector<T, N, Allocator, GrowthPolicy>& rhs) {
+	lhs.swap(rhs);
+}
+
+/* <-- NON-MEMBER FUNCTION OVERLOADS END */
+
+/* PRIVATE FUNCTIONS START --> */
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+typename small_vector<T, N, Allocator, GrowthPolicy>::pointer small_vector<T, N, Allocator, GrowthPolicy>::_inline_buffer(void) {
+	return reinterpret_cast<pointer>(_storage.bytes);
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+void small_vector<T, N, Allocator, GrowthPolicy>::_swap_inline(small_vector& other) {
+	small_vector&	longer = vector_type::size() < other.size() ? other : *this;
+	small_vector&	shorter = &longer == this ? other : *this;
+	size_type		common = shorter.size();
+
+	/* Both sides fit in N ==> swap the common prefix, then hand the rest over without touching the heap */
+
+	for (size_type i = 0; i < common; ++i) {
+		value_type	tmp(shorter[i]);
+
+		shorter[i] = longer[i];
+		longer[i] = tmp;
+	}
+	shorter.vector_type::insert(shorter.end(), longer.begin() + common, longer.end());
+	longer.vector_type::erase(longer.begin() + common, longer.end());
+}
+
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+void small_vector<T, N, Allocator, GrowthPolicy>::_swap_spilled(small_vector& spilled) {
+	pointer		heap = spilled._pointer;
+	size_type	heap_size = spilled._size;
+	size_type	heap_capacity = spilled._capacity;
+
+	/* *this is inline, spilled is on the heap: spilled takes its own buffer back and a copy of our elements,
+	   then we adopt its heap storage. On a throw the heap storage goes back to spilled */
+
+	spilled._pointer = nullptr;
+	spilled._size = 0;
+	spilled._capacity = 0;
+	try {
+		spilled.vector_type::reserve(N);
+		spilled.vector_type::assign(vector_type::begin(), vector_type::end());
+	}
+	catch (...) {
+		spilled.vector_type::clear();
+		if (spilled._pointer)
+			spilled._alloc.deallocate(spilled._pointer, spilled._capacity);
+		spilled._pointer = heap;
+		spilled._size = heap_size;
+		spilled._capacity = heap_capacity;
+		throw ;
+	}
+	vector_type::clear();
+	vector_type::_alloc.deallocate(vector_type::_pointer, vector_type::_capacity);
+	vector_type::_pointer = heap;
+	vector_type::_size = heap_size;
+	vector_type::_capacity = heap_capacity;
+}
+
+/* <-- PRIVATE FUNCTIONS END */
+
+
+} /* FT NAMESPACE */
+
+#endif /* SMALL_VECTOR_H */
@@ -14,8 +14,15 @@
 # define VECTOR_H
 
 # include <memory>
+# include <cstring>
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 # include "Additional/equal.hpp"
+# include "Additional/growth_policy.hpp"
 # include "Additional/is_integral.hpp"
+# include "Additional/is_trivially_copyable.hpp"
+# include "Additional/is_trivially_relocatable.hpp"
 # include "Additional/iterator_traits.hpp"
 # include "Additional/vector_iterator.hpp"
 # include "Additional/reverse_iterator.hpp"
@@ -24,13 +31,17 @@
 namespace ft
 {
 
-template <typename T, typename Allocator = std::allocator<T> >
+template <typename T, std::size_t N, typename Allocator, typename GrowthPolicy>
+class small_vector;
+
+template <typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = ft::geometric_growth<2, 1> >
 class vector {
 
 public:
 	/* MEMBER TYPES */
 	
 	typedef Allocator										allocator_type;
+	typedef GrowthPolicy									growth_policy;
 	typedef T												value_type;
 	typedef typename allocator_type::pointer				pointer;
 	typedef typename allocator_type::reference				reference;
@@ -73,6 +84,7 @@ public:
 	size_type	capacity(void) const;
 	bool		empty(void) const;
 	void		reserve(size_type n);
+	void		shrink_to_fit(void);
 
 	/* ELEMENT ACCESS */
 
@@ -93,6 +105,27 @@ public:
 	void		assign(Iterator first, Iterator last);
 	void		assign(size_type n, const value_type& val);
 	void		push_back(const value_type& val);
+# if __cplusplus >= 201103L
+	template <typename... Args>
+	void		emplace_back(Args&&... args);
+	template <typename... Args>
+	iterator	emplace(iterator position, Args&&... args);
+# else
+	void		emplace_back(void);
+	template <typename A1>
+	void		emplace_back(const A1& a1);
+	template <typename A1, typename A2>
+	void		emplace_back(const A1& a1, const A2& a2);
+	template <typename A1, typename A2, typename A3>
+	void		emplace_back(const A1& a1, const A2& a2, const A3& a3);
+	iterator	emplace(iterator position);
+	template <typename A1>
+	iterator	emplace(iterator position, const A1& a1);
+	template <typename A1, typename A2>
+	iterator	emplace(iterator position, const A1& a1, const A2& a2);
+	template <typename A1, typename A2, typename A3>
+	iterator	emplace(iterator position, const A1& a1, const A2& a2, const A3& a3);
+# endif
 	void		pop_back(void);
 	template <typename Iterator>
 	void		insert(iterator position, Iterator first, Iterator last);
@@ -109,10 +142,19 @@ public:
 
 	/* NON-MEMBER FUNCTION OVERLOADS */
 
-	template <typename Y, typename Alloc>
-	friend void swap(vector<Y, Alloc>& lhs, vector<Y, Alloc>& rhs);
+	template <typename Y, typename Alloc, typename Growth>
+	friend void swap(vector<Y, Alloc, Growth>& lhs, vector<Y, Alloc, Growth>& rhs);
 
 private:
+	/* small_vector hands heap storage over to another small_vector in swap */
+
+	template <typename Y, std::size_t N, typename Alloc, typename Growth>
+	friend class small_vector;
+
+	/* MEMBER TYPES */
+
+	typedef typename ft::is_trivially_copyable<T>::type		trivial_type;
+
 	/* ATTRIBUTES */
 
 	size_type		_size;
@@ -120,6 +162,13 @@ private:
 	size_type		_capacity;
 	pointer			_pointer;
 
+	/* GROWTH: every implicit reallocation asks GrowthPolicy for the new capacity */
+
+	size_type	_next_capacity(size_type required) const;
+	void		_grow(size_type required);
+	pointer		_allocate_for_append(size_type& capacity);
+	void		_grow_into(pointer buffer, size_type capacity);
+
 	/* CONSTRUCTOR TEMPLATE OVERLOADING */
 
 	template <typename _Integer>
@@ -149,42 +198,61 @@ private:
 	template <typename ForwardIterator>
 	void	__insert_range(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag);
 
+	/* RELOCATION TEMPLATE OVERLOADING */
+
+	void	__relocate(pointer dest, ft::true_type);
+	void	__relocate(pointer dest, ft::false_type);
+
+	/* ELEMENT KERNELS: memmove/memcpy/memset for trivially copyable types, element loops otherwise */
+
+	void	__move_forward(pointer first, pointer last, pointer dest, ft::true_type);
+	void	__move_forward(pointer first, pointer last, pointer dest, ft::false_type);
+	void	__move_backward(pointer first, pointer last, pointer dest_last, ft::true_type);
+	void	__move_backward(pointer first, pointer last, pointer dest_last, ft::false_type);
+	void	__uninitialized_copy(pointer first, pointer last, pointer dest, ft::true_type);
+	void	__uninitialized_copy(pointer first, pointer last, pointer dest, ft::false_type);
+	void	__fill(pointer first, pointer last, const value_type& val, ft::true_type);
+	void	__fill(pointer first, pointer last, const value_type& val, ft::false_type);
+	void	__uninitialized_fill(pointer first, pointer last, const value_type& val, ft::true_type);
+	void	__uninitialized_fill(pointer first, pointer last, const value_type& val, ft::false_type);
+	void	__destroy(pointer first, pointer last);
+
 };
 
 /* CONSTRUCTORS AND DESTRUCTOR START --> */
 
-template <typename T, typename Allocator>
-vector<T, Allocator>::vector(const allocator_type& alloc) : _size(0), _alloc(alloc), _capacity(0), _pointer(nullptr) {}
+template <typename T, typename Allocator, typename GrowthPolicy>
+vector<T, Allocator, GrowthPolicy>::vector(const allocator_type& alloc) : _size(0), _alloc(alloc), _capacity(0), _pointer(nullptr) {}
 
-template <typename T, typename Allocator>
-vector<T, Allocator>::vector(size_type n, const value_type& val, const allocator_type& alloc) : _size(0), _alloc(alloc), _capacity(n), _pointer(_alloc.allocate(_capacity)) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+vector<T, Allocator, GrowthPolicy>::vector(size_type n, const value_type& val, const allocator_type& alloc) : _size(0), _alloc(alloc), _capacity(n), _pointer(_alloc.allocate(_capacity)) {
 	while (_size < _capacity)
 		_alloc.construct(&_pointer[_size++], val);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InputIterator>
-vector<T, Allocator>::vector(InputIterator first, InputIterator last, const allocator_type& alloc) : _size(0), _alloc(alloc), _capacity(0), _pointer(nullptr) {
+vector<T, Allocator, GrowthPolicy>::vector(InputIterator first, InputIterator last, const allocator_type& alloc) : _size(0), _alloc(alloc), _capacity(0), _pointer(nullptr) {
 	typedef typename ft::is_integral<InputIterator>::type _Integer;
 	__construct(first, last, _Integer());
 }
 
-template <typename T, typename Allocator>
-vector<T, Allocator>::vector(const vector& other) : _size(0), _alloc(other._alloc), _capacity(other._capacity), _pointer(_alloc.allocate(_capacity)) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+vector<T, Allocator, GrowthPolicy>::vector(const vector& other) : _size(0), _alloc(other._alloc), _capacity(other._capacity), _pointer(_alloc.allocate(_capacity)) {
 	for (; _size < other._size; ++_size)
 		_alloc.construct(&_pointer[_size], other._pointer[_size]);
 }
 
-template <typename T, typename Allocator>
-vector<T, Allocator>::~vector() {
+template <typename T, typename Allocator, typename GrowthPolicy>
+vector<T, Allocator, GrowthPolicy>::~vector() {
 	if (_pointer) {
 		clear();
 		_alloc.deallocate(_pointer, _capacity);
 	}
 }
 
-template <typename T, typename Allocator>
-vector<T, Allocator>&	vector<T, Allocator>::operator = (const vector& other) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+vector<T, Allocator, GrowthPolicy>&	vector<T, Allocator, GrowthPolicy>::operator = (const vector& other) {
 	if (*this != other) {
 		clear();
 		if (_pointer)
@@ -202,43 +270,43 @@ vector<T, Allocator>&	vector<T, Allocator>::operator = (const vector& other) {
 
 /* ITERATORS START --> */
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::begin(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::begin(void) {
 	return iterator(_pointer);
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_iterator vector<T, Allocator>::begin(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_iterator vector<T, Allocator, GrowthPolicy>::begin(void) const {
 	return const_iterator(_pointer);
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::end(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::end(void) {
 	return iterator(_pointer + static_cast<difference_type>(_size));
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_iterator vector<T, Allocator>::end(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_iterator vector<T, Allocator, GrowthPolicy>::end(void) const {
 	return const_iterator(_pointer + static_cast<difference_type>(_size));
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::reverse_iterator vector<T, Allocator>::rbegin(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::reverse_iterator vector<T, Allocator, GrowthPolicy>::rbegin(void) {
 	return reverse_iterator(end());
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::reverse_iterator vector<T, Allocator>::rend(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::reverse_iterator vector<T, Allocator, GrowthPolicy>::rend(void) {
 	return reverse_iterator(begin());
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_reverse_iterator vector<T, Allocator>::rbegin(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator vector<T, Allocator, GrowthPolicy>::rbegin(void) const {
 	return const_reverse_iterator(end());
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_reverse_iterator vector<T, Allocator>::rend(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_reverse_iterator vector<T, Allocator, GrowthPolicy>::rend(void) const {
 	return const_reverse_iterator(begin());
 }
 
@@ -246,18 +314,18 @@ typename vector<T, Allocator>::const_reverse_iterator vector<T, Allocator>::rend
 
 /* CAPACITY START --> */
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::size_type vector<T, Allocator>::size(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::size_type vector<T, Allocator, GrowthPolicy>::size(void) const {
 	return _size;
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::size_type vector<T, Allocator>::max_size(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::size_type vector<T, Allocator, GrowthPolicy>::max_size(void) const {
 	return _alloc.max_size() > __LONG_LONG_MAX__ ? __LONG_LONG_MAX__ : _alloc.max_size();
 }
 
-template <typename T, typename Allocator>
-void vector<T, Allocator>::resize(size_type n, const value_type& val) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::resize(size_type n, const value_type& val) {
 	if (n <= _size)
 		for (size_type i = n; i < _size; ++i)
 			_alloc.destroy(&_pointer[i]);
@@ -265,34 +333,38 @@ void vector<T, Allocator>::resize(size_type n, const value_type& val) {
 		for (size_type i = _size; i < n; ++i)
 			_alloc.construct(&_pointer[i], val);
 	else {
-		reserve(n > _capacity * 2 ? n : _capacity * 2);
+		_grow(n);
 		for (size_type i = _size; i < n; ++i)
 			_alloc.construct(&_pointer[i], val);
 	}
 	_size = n;
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::size_type vector<T, Allocator>::capacity(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::size_type vector<T, Allocator, GrowthPolicy>::capacity(void) const {
 	return _capacity;
 }
 
-template <typename T, typename Allocator>
-bool vector<T, Allocator>::empty(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+bool vector<T, Allocator, GrowthPolicy>::empty(void) const {
 	return _size == 0 ? true : false;
 }
 
-template <typename T, typename Allocator>
-void vector<T, Allocator>::reserve(size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::reserve(size_type n) {
 	if (n > max_size())
 		throw std::length_error("vector");
 	else if (n > _capacity) {
+		typedef typename ft::is_trivially_relocatable<value_type>::type	_Relocatable;
 		pointer copy = _alloc.allocate(n);
 
 		if (_pointer) {
-			for (size_type i = 0; i < _size; ++i) {
-				_alloc.construct(&copy[i], _pointer[i]);
-				_alloc.destroy(&_pointer[i]);
+			try {
+				__relocate(copy, _Relocatable());
+			}
+			catch (...) {
+				_alloc.deallocate(copy, n);
+				throw ;
 			}
 			_alloc.deallocate(_pointer, _capacity);
 		}
@@ -301,61 +373,83 @@ void vector<T, Allocator>::reserve(size_type n) {
 	}
 }
 
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::shrink_to_fit(void) {
+	typedef typename ft::is_trivially_relocatable<value_type>::type	_Relocatable;
+
+	if (_capacity == _size)
+		return ;
+
+	pointer	copy = _size ? _alloc.allocate(_size) : nullptr;
+
+	try {
+		__relocate(copy, _Relocatable());
+	}
+	catch (...) {
+		if (copy)
+			_alloc.deallocate(copy, _size);
+		throw ;
+	}
+	_alloc.deallocate(_pointer, _capacity);
+	_pointer = copy;
+	_capacity = _size;
+}
+
 /* <-- CAPACITY END */
 
 /* ELEMENT ACCESS START --> */
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::operator [] (const difference_type& offset) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::reference vector<T, Allocator, GrowthPolicy>::operator [] (const difference_type& offset) {
 	return *(_pointer + offset);
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::operator [] (const difference_type& offset) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_reference vector<T, Allocator, GrowthPolicy>::operator [] (const difference_type& offset) const {
 	return *(_pointer + offset);
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::at(size_type n) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::reference vector<T, Allocator, GrowthPolicy>::at(size_type n) {
 	if (n >= _size)
 		throw std::out_of_range("vector");
 	return _pointer[n];
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::at(size_type n) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_reference vector<T, Allocator, GrowthPolicy>::at(size_type n) const {
 	if (n >= _size)
 		throw std::out_of_range("vector");
 	return _pointer[n];
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::front(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::reference vector<T, Allocator, GrowthPolicy>::front(void) {
 	return *_pointer;
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::front(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_reference vector<T, Allocator, GrowthPolicy>::front(void) const {
 	return *_pointer;
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::back(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::reference vector<T, Allocator, GrowthPolicy>::back(void) {
 	return *(_pointer + static_cast<difference_type>(_size - 1));
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::back(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::const_reference vector<T, Allocator, GrowthPolicy>::back(void) const {
 	return *(_pointer + static_cast<difference_type>(_size - 1));
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::value_type* vector<T, Allocator>::data(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::value_type* vector<T, Allocator, GrowthPolicy>::data(void) {
 	return static_cast<value_type*>(_pointer);
 }
 
-template <typename T, typename Allocator>
-const typename vector<T, Allocator>::value_type* vector<T, Allocator>::data(void) const {
+template <typename T, typename Allocator, typename GrowthPolicy>
+const typename vector<T, Allocator, GrowthPolicy>::value_type* vector<T, Allocator, GrowthPolicy>::data(void) const {
 	return static_cast<value_type*>(_pointer);
 }
 
@@ -363,15 +457,15 @@ const typename vector<T, Allocator>::value_type* vector<T, Allocator>::data(void
 
 /* MODIFIERS START --> */
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename Iterator>
-void	vector<T, Allocator>::assign(Iterator first, Iterator last) {
+void	vector<T, Allocator, GrowthPolicy>::assign(Iterator first, Iterator last) {
 	typedef typename ft::is_integral<Iterator>::type	_Integer;
 	__assign(first, last, _Integer());
 }
 
-template <typename T, typename Allocator>
-void	vector<T, Allocator>::assign(size_type n, const value_type& val) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::assign(size_type n, const value_type& val) {
 	clear();
 	if (n > _capacity)
 		reserve(n);
@@ -380,115 +474,232 @@ void	vector<T, Allocator>::assign(size_type n, const value_type& val) {
 		_alloc.construct(&_pointer[_size++], val);
 }
 
-template <typename T, typename Allocator>
-void vector<T, Allocator>::push_back(const value_type& val) {
-	if (!_capacity)
-		reserve(10);
-	else if (_size == _capacity)
-		reserve(_capacity * 2);
-	_alloc.construct(&_pointer[_size++], val);
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::push_back(const value_type& val) {
+	if (_size == _capacity) {
+		/* val may be an element ==> build it in the new buffer while the old one is still there */
+
+		size_type	capacity = 0;
+		pointer		buffer = _allocate_for_append(capacity);
+
+		try {
+			_alloc.construct(&buffer[_size], val);
+		}
+		catch (...) {
+			_alloc.deallocate(buffer, capacity);
+			throw ;
+		}
+		_grow_into(buffer, capacity);
+	}
+	else
+		_alloc.construct(&_pointer[_size], val);
+	++_size;
 }
 
-template <typename T, typename Allocator>
-void vector<T, Allocator>::pop_back(void) {
+# if __cplusplus >= 201103L
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+void vector<T, Allocator, GrowthPolicy>::emplace_back(Args&&... args) {
+	if (_size == _capacity) {
+		/* The arguments may refer to elements ==> build the value in the new buffer before the old one goes */
+
+		size_type	capacity = 0;
+		pointer		buffer = _allocate_for_append(capacity);
+
+		try {
+			_alloc.construct(&buffer[_size], std::forward<Args>(args)...);
+		}
+		catch (...) {
+			_alloc.deallocate(buffer, capacity);
+			throw ;
+		}
+		_grow_into(buffer, capacity);
+	}
+	else
+		_alloc.construct(&_pointer[_size], std::forward<Args>(args)...);
+	++_size;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename... Args>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::emplace(iterator position, Args&&... args) {
+	difference_type	before = position - begin();
+
+	if (static_cast<size_type>(before) == _size) {
+		emplace_back(std::forward<Args>(args)...);
+		return iterator(&_pointer[before]);
+	}
+
+	value_type	tmp(std::forward<Args>(args)...);
+
+	_grow(_size + 1);
+	_alloc.construct(&_pointer[_size], std::move(_pointer[_size - 1]));
+	__move_backward(_pointer + before, _pointer + _size - 1, _pointer + _size, trivial_type());
+	_pointer[before] = std::move(tmp);
+	++_size;
+	return iterator(&_pointer[before]);
+}
+
+# else
+
+/* A C++98 allocator can only copy-construct ==> the value is built once and copied into place by push_back */
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::emplace_back(void) {
+	push_back(value_type());
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename A1>
+void vector<T, Allocator, GrowthPolicy>::emplace_back(const A1& a1) {
+	push_back(value_type(a1));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename A1, typename A2>
+void vector<T, Allocator, GrowthPolicy>::emplace_back(const A1& a1, const A2& a2) {
+	push_back(value_type(a1, a2));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename A1, typename A2, typename A3>
+void vector<T, Allocator, GrowthPolicy>::emplace_back(const A1& a1, const A2& a2, const A3& a3) {
+	push_back(value_type(a1, a2, a3));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::emplace(iterator position) {
+	difference_type	before = position - begin();
+
+	if (static_cast<size_type>(before) != _size)
+		return insert(position, value_type());
+	emplace_back();
+	return iterator(&_pointer[before]);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename A1>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::emplace(iterator position, const A1& a1) {
+	difference_type	before = position - begin();
+
+	if (static_cast<size_type>(before) != _size)
+		return insert(position, value_type(a1));
+	emplace_back(a1);
+	return iterator(&_pointer[before]);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename A1, typename A2>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::emplace(iterator position, const A1& a1, const A2& a2) {
+	difference_type	before = position - begin();
+
+	if (static_cast<size_type>(before) != _size)
+		return insert(position, value_type(a1, a2));
+	emplace_back(a1, a2);
+	return iterator(&_pointer[before]);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+template <typename A1, typename A2, typename A3>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::emplace(iterator position, const A1& a1, const A2& a2, const A3& a3) {
+	difference_type	before = position - begin();
+
+	if (static_cast<size_type>(before) != _size)
+		return insert(position, value_type(a1, a2, a3));
+	emplace_back(a1, a2, a3);
+	return iterator(&_pointer[before]);
+}
+
+# endif
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::pop_back(void) {
 	if (_size)
 		_alloc.destroy(&_pointer[--_size]);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename Iterator>
-void vector<T, Allocator>::insert (iterator position, Iterator first, Iterator last) {
+void vector<T, Allocator, GrowthPolicy>::insert (iterator position, Iterator first, Iterator last) {
 	typedef typename ft::is_integral<Iterator>::type	_Integral;
 	__insert(position, first, last, _Integral());
 }
 
-template <typename T, typename Allocator>
-void vector<T, Allocator>::insert (iterator position, size_type n, const value_type& val) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::insert (iterator position, size_type n, const value_type& val) {
 	size_type	before = position - begin();
 
 	if (!n)
 		return ;
-	if (_size + n > _capacity)
-		reserve(_size + n > _capacity * 2 ? _size + n : _capacity * 2);
-	if (_size) {
-		size_type i = _size + n - 1;
-		size_type j = _size - 1;
-		
-		while (i >= _size && j > 0)
-			_alloc.construct(&_pointer[i--], _pointer[j--]);
-		if (i >= _size && j == 0)
-			_alloc.construct(&_pointer[i--], _pointer[j]);
-		while (i >= _size)
-			_alloc.construct(&_pointer[i--], value_type());
-		while (i >= before && j > 0)
-			_pointer[i--] = _pointer[j--];
-		if (i >= before && j == 0)
-			_pointer[i--] = _pointer[j];
-		for (size_type i = 0; i < n; ++i)
-			_pointer[before + i] = val;
+
+	value_type	copy(val);
+
+	_grow(_size + n);
+
+	pointer		pos = _pointer + before;
+	pointer		old_end = _pointer + _size;
+	size_type	after = _size - before;
+
+	if (after > n) {
+		__uninitialized_copy(old_end - n, old_end, old_end, trivial_type());
+		__move_backward(pos, pos + (after - n), old_end, trivial_type());
+		__fill(pos, pos + n, copy, trivial_type());
+	}
+	else {
+		__uninitialized_fill(old_end, pos + n, copy, trivial_type());
+		__uninitialized_copy(pos, old_end, pos + n, trivial_type());
+		__fill(pos, old_end, copy, trivial_type());
 	}
-	else
-		for (size_type i = 0; i < n; ++i)
-			_alloc.construct(&_pointer[i], val);
 	_size += n;
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::insert (iterator position, const value_type& val) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::insert (iterator position, const value_type& val) {
 	difference_type	before = position - begin();
+	value_type		copy(val);
 
-	if (_size == _capacity)
-		reserve(_capacity ? _capacity * 2 : 1000);
-	if (!_size)
-		_alloc.construct(_pointer, val);
+	_grow(_size + 1);
+	if (static_cast<size_type>(before) == _size)
+		_alloc.construct(&_pointer[_size], copy);
 	else {
 		_alloc.construct(&_pointer[_size], _pointer[_size - 1]);
-		for (difference_type i = _size - 1; i >= before && i > 0; --i)
-			_pointer[i] = _pointer[i - 1];
-		_pointer[before] = val;
+		__move_backward(_pointer + before, _pointer + _size - 1, _pointer + _size, trivial_type());
+		_pointer[before] = copy;
 	}
 	++_size;
 	return iterator(&_pointer[before]);
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(iterator position) {
-	difference_type	move_diff = (end() - position) - 1;
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::erase(iterator position) {
+	pointer	pos = _pointer + (position - begin());
 
-	for (difference_type i = 0; i < move_diff; ++i)
-		*(position + i) = *(position + i + 1);
-	_alloc.destroy(&*(position + move_diff));
-	--_size;
+	__move_forward(pos + 1, _pointer + _size, pos, trivial_type());
+	_alloc.destroy(&_pointer[--_size]);
 	return position;
 }
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(iterator first, iterator last) {
-	difference_type	move_diff = (end() - last);
-	difference_type	erase_diff =  last - first;
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::iterator vector<T, Allocator, GrowthPolicy>::erase(iterator first, iterator last) {
+	size_type	erase_diff = last - first;
 
 	if (!erase_diff)
 		return last;
-	if (last != end()) {
-		for (difference_type i = 0; i < move_diff; ++i)
-			*(first + i) = *(last + i);
-	}
-	for (difference_type i = 0; i < erase_diff; ++i) {
-		_alloc.destroy(&*(first + move_diff + i));
-		--_size;
-	}
+	__move_forward(_pointer + (last - begin()), _pointer + _size, _pointer + (first - begin()), trivial_type());
+	__destroy(_pointer + _size - erase_diff, _pointer + _size);
+	_size -= erase_diff;
 	return first;
-	
 }
 
-template <typename T, typename Allocator>
-void vector<T, Allocator>::clear(void) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::clear(void) {
 	while (_size > 0)
 		_alloc.destroy(&_pointer[--_size]);
 }
 
-template <typename T, typename Allocator>
-void vector<T, Allocator>::swap(vector& other) {
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::swap(vector& other) {
 	pointer		p_copy = _pointer;
 	size_type	s_copy = _size;
 	size_type	c_copy = _capacity;
@@ -502,52 +713,52 @@ void vector<T, Allocator>::swap(vector& other) {
 
 /* ALLOCATOR START --> */
 
-template <typename T, typename Allocator>
-typename vector<T, Allocator>::allocator_type vector<T, Allocator>::get_allocator(void) const {
-	return allocator_type();
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::allocator_type vector<T, Allocator, GrowthPolicy>::get_allocator(void) const {
+	return _alloc;
 }
 
 /* <-- ALLOCATOR END */
 
 /* NON-MEMBER FUNCTION OVERLOADS START --> */
 
-template <class T, class Allocator>
-bool operator	==	(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs) {
+template <class T, class Allocator, class GrowthPolicy>
+bool operator	==	(const vector<T, Allocator, GrowthPolicy>& lhs, const vector<T, Allocator, GrowthPolicy>& rhs) {
 	if (lhs.size() != rhs.size())
 		return false;
 	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <class T, class Allocator>
-bool operator	!=	(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs) {
+template <class T, class Allocator, class GrowthPolicy>
+bool operator	!=	(const vector<T, Allocator, GrowthPolicy>& lhs, const vector<T, Allocator, GrowthPolicy>& rhs) {
 	return !(lhs == rhs);
 }
 
-template <class T, class Allocator>
-bool operator	<	(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs) {
+template <class T, class Allocator, class GrowthPolicy>
+bool operator	<	(const vector<T, Allocator, GrowthPolicy>& lhs, const vector<T, Allocator, GrowthPolicy>& rhs) {
 	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template <class T, class Allocator>
-bool operator	<=	(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs) {
+template <class T, class Allocator, class GrowthPolicy>
+bool operator	<=	(const vector<T, Allocator, GrowthPolicy>& lhs, const vector<T, Allocator, GrowthPolicy>& rhs) {
 	return !(rhs < lhs);
 }
 
-template <class T, class Allocator>
-bool operator	>	(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs) {
+template <class T, class Allocator, class GrowthPolicy>
+bool operator	>	(const vector<T, Allocator, GrowthPolicy>& lhs, const vector<T, Allocator, GrowthPolicy>& rhs) {
 	return (rhs < lhs);
 }
 
-template <class T, class Allocator>
-bool operator	>=	(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs) {
+template <class T, class Allocator, class GrowthPolicy>
+bool operator	>=	(const vector<T, Allocator, GrowthPolicy>& lhs, const vector<T, Allocator, GrowthPolicy>& rhs) {
 	return !(lhs < rhs);
 }
 
-template <typename Y, typename Alloc>
-void swap(vector<Y, Alloc>& lhs, vector<Y, Alloc>& rhs) {
-	typename vector<Y, Alloc>::pointer		p_copy = lhs._pointer;
-	typename vector<Y, Alloc>::size_type	s_copy = lhs._size;
-	typename vector<Y, Alloc>::size_type	c_copy = lhs._capacity;
+template <typename Y, typename Alloc, typename Growth>
+void swap(vector<Y, Alloc, Growth>& lhs, vector<Y, Alloc, Growth>& rhs) {
+	typename vector<Y, Alloc, Growth>::pointer		p_copy = lhs._pointer;
+	typename vector<Y, Alloc, Growth>::size_type	s_copy = lhs._size;
+	typename vector<Y, Alloc, Growth>::size_type	c_copy = lhs._capacity;
 
 	lhs._pointer = rhs._pointer; rhs._pointer = p_copy;
 	lhs._size = rhs._size; rhs._size = s_copy;
@@ -558,35 +769,78 @@ void swap(vector<Y, Alloc>& lhs, vector<Y, Alloc>& rhs) {
 
 /* PRIVATE FUNCTIONS START --> */
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::size_type vector<T, Allocator, GrowthPolicy>::_next_capacity(size_type required) const {
+	size_type	new_capacity = GrowthPolicy::next_capacity(_capacity, required);
+
+	if (new_capacity > max_size())
+		new_capacity = required > max_size() ? required : max_size();
+	return new_capacity;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::_grow(size_type required) {
+	if (required > _capacity)
+		reserve(_next_capacity(required));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+typename vector<T, Allocator, GrowthPolicy>::pointer vector<T, Allocator, GrowthPolicy>::_allocate_for_append(size_type& capacity) {
+	if (_size + 1 > max_size())
+		throw std::length_error("vector");
+	capacity = _next_capacity(_size + 1);
+	return _alloc.allocate(capacity);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void vector<T, Allocator, GrowthPolicy>::_grow_into(pointer buffer, size_type capacity) {
+	typedef typename ft::is_trivially_relocatable<value_type>::type	_Relocatable;
+
+	/* buffer already holds the appended element at _size: relocate the others in front of it and adopt buffer */
+
+	try {
+		__relocate(buffer, _Relocatable());
+	}
+	catch (...) {
+		_alloc.destroy(&buffer[_size]);
+		_alloc.deallocate(buffer, capacity);
+		throw ;
+	}
+	if (_pointer)
+		_alloc.deallocate(_pointer, _capacity);
+	_pointer = buffer;
+	_capacity = capacity;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename _Integer>
-void vector<T, Allocator>::__construct(_Integer size, _Integer val, ft::true_type) {
+void vector<T, Allocator, GrowthPolicy>::__construct(_Integer size, _Integer val, ft::true_type) {
 	__assign(size, val, ft::true_type());
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename _Iterator>
-void vector<T, Allocator>::__construct(_Iterator first, _Iterator last, ft::false_type) {
+void vector<T, Allocator, GrowthPolicy>::__construct(_Iterator first, _Iterator last, ft::false_type) {
 	typedef typename std::iterator_traits<_Iterator>::iterator_category _Category;
 	__assign_range(first, last, _Category());
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename _Integer>
-void	vector<T, Allocator>::__assign(_Integer size, _Integer val, ft::true_type) {
+void	vector<T, Allocator, GrowthPolicy>::__assign(_Integer size, _Integer val, ft::true_type) {
 	assign(static_cast<size_type>(size), val);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename _Iterator>
-void	vector<T, Allocator>::__assign(_Iterator first, _Iterator last, ft::false_type) {
+void	vector<T, Allocator, GrowthPolicy>::__assign(_Iterator first, _Iterator last, ft::false_type) {
 	typedef typename std::iterator_traits<_Iterator>::iterator_category _Category;
 	__assign_range(first, last, _Category());
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InputIterator>
-void	vector<T, Allocator>::__assign_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
+void	vector<T, Allocator, GrowthPolicy>::__assign_range(InputIterator first, InputIterator last, std::input_iterator_tag) {
 	for (; _capacity && first != last && _size <= _capacity; ++_size, ++first)
 		_alloc.construct(&_pointer[_size], *first);
 	if (first == last && _size)
@@ -595,9 +849,9 @@ void	vector<T, Allocator>::__assign_range(InputIterator first, InputIterator las
 		__insert_range(end(), first, last, std::input_iterator_tag());
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename ForwardIterator>
-void	vector<T, Allocator>::__assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+void	vector<T, Allocator, GrowthPolicy>::__assign_range(ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
 	size_type	new_size = std::distance(first, last);
 
 	clear();
@@ -608,57 +862,171 @@ void	vector<T, Allocator>::__assign_range(ForwardIterator first, ForwardIterator
 		_alloc.construct(&_pointer[_size++], *first++);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename _Integer>
-void	vector<T, Allocator>::__insert(iterator position, _Integer n, _Integer val, ft::true_type) {
+void	vector<T, Allocator, GrowthPolicy>::__insert(iterator position, _Integer n, _Integer val, ft::true_type) {
 	insert(position, static_cast<size_type>(n), val);
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename _Iterator>
-void	vector<T, Allocator>::__insert(iterator position, _Iterator first, _Iterator last, ft::false_type) {
+void	vector<T, Allocator, GrowthPolicy>::__insert(iterator position, _Iterator first, _Iterator last, ft::false_type) {
 	typedef typename std::iterator_traits<_Iterator>::iterator_category	_Category;
 	__insert_range(position, first, last, _Category());
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename InputIterator>
-void	vector<T, Allocator>::__insert_range(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag) {
+void	vector<T, Allocator, GrowthPolicy>::__insert_range(iterator position, InputIterator first, InputIterator last, std::input_iterator_tag) {
 	for (; first != last; ++first) {
 		position = insert(position, *first);
 		++position;
 	}
 }
 
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename GrowthPolicy>
 template <typename ForwardIterator>
-void	vector<T, Allocator>::__insert_range(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
-	difference_type	before = position - begin();
-	difference_type	n = std::distance(first, last);
-	difference_type d_size = static_cast<difference_type>(_size);
+void	vector<T, Allocator, GrowthPolicy>::__insert_range(iterator position, ForwardIterator first, ForwardIterator last, std::forward_iterator_tag) {
+	size_type	before = position - begin();
+	size_type	n = std::distance(first, last);
 
 	if (!n)
 		return ;
-	reserve(_size + n);
-	if (_size) {
-		difference_type i = _size + n - 1;
-		difference_type j = _size - 1;
-		
-		while (i >= d_size && j >= 0)
-			_alloc.construct(&_pointer[i--], _pointer[j--]);
-		while (i >= d_size)
-			_alloc.construct(&_pointer[i--], value_type());
-		while (i >= before && j >= 0)
-			_pointer[i--] = _pointer[j--];
-		for (difference_type i = 0; i < n; ++i, ++first)
-			_pointer[before + i] = *first;
+	_grow(_size + n);
+
+	pointer		pos = _pointer + before;
+	pointer		old_end = _pointer + _size;
+	size_type	after = _size - before;
+
+	if (after > n) {
+		__uninitialized_copy(old_end - n, old_end, old_end, trivial_type());
+		__move_backward(pos, pos + (after - n), old_end, trivial_type());
+		for (; first != last; ++first, ++pos)
+			*pos = *first;
+	}
+	else {
+		ForwardIterator	mid = first;
+
+		std::advance(mid, after);
+		for (pointer dest = old_end; mid != last; ++mid, ++dest)
+			_alloc.construct(dest, *mid);
+		__uninitialized_copy(pos, old_end, pos + n, trivial_type());
+		for (; pos != old_end; ++first, ++pos)
+			*pos = *first;
 	}
-	else
-		for (difference_type i = 0; i < n; ++i, ++first)
-			_alloc.construct(&_pointer[i], *first);
 	_size += n;
 }
 
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__relocate(pointer dest, ft::true_type) {
+	if (_size)
+		std::memcpy(static_cast<void*>(dest), static_cast<const void*>(_pointer), _size * sizeof (value_type));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__relocate(pointer dest, ft::false_type) {
+	size_type	i = 0;
+
+	/* Build the whole copy first: a throwing move is not used, so on a throw the old buffer is intact
+	   ==> destroy what was built in dest, the caller frees it */
+
+	try {
+		for (; i < _size; ++i)
+# if __cplusplus >= 201103L
+			_alloc.construct(&dest[i], std::move_if_noexcept(_pointer[i]));
+# else
+			_alloc.construct(&dest[i], _pointer[i]);
+# endif
+	}
+	catch (...) {
+		while (i)
+			_alloc.destroy(&dest[--i]);
+		throw ;
+	}
+	for (i = 0; i < _size; ++i)
+		_alloc.destroy(&_pointer[i]);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__move_forward(pointer first, pointer last, pointer dest, ft::true_type) {
+	if (first < last)
+		std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof (value_type));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__move_forward(pointer first, pointer last, pointer dest, ft::false_type) {
+	for (; first != last; ++first, ++dest)
+# if __cplusplus >= 201103L
+		*dest = std::move(*first);
+# else
+		*dest = *first;
+# endif
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__move_backward(pointer first, pointer last, pointer dest_last, ft::true_type) {
+	if (first < last)
+		std::memmove(static_cast<void*>(dest_last - (last - first)), static_cast<const void*>(first), (last - first) * sizeof (value_type));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__move_backward(pointer first, pointer last, pointer dest_last, ft::false_type) {
+	while (first != last)
+# if __cplusplus >= 201103L
+		*--dest_last = std::move(*--last);
+# else
+		*--dest_last = *--last;
+# endif
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__uninitialized_copy(pointer first, pointer last, pointer dest, ft::true_type) {
+	if (first < last)
+		std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof (value_type));
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__uninitialized_copy(pointer first, pointer last, pointer dest, ft::false_type) {
+	for (; first != last; ++first, ++dest)
+		_alloc.construct(dest, *first);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__fill(pointer first, pointer last, const value_type& val, ft::true_type) {
+	/* Single-byte values are a plain memset */
+
+	if (sizeof (value_type) == 1) {
+		if (first < last)
+			std::memset(static_cast<void*>(first), *reinterpret_cast<const unsigned char*>(&val), last - first);
+	}
+	else
+		for (; first != last; ++first)
+			*first = val;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__fill(pointer first, pointer last, const value_type& val, ft::false_type) {
+	for (; first != last; ++first)
+		*first = val;
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__uninitialized_fill(pointer first, pointer last, const value_type& val, ft::true_type) {
+	__fill(first, last, val, ft::true_type());
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__uninitialized_fill(pointer first, pointer last, const value_type& val, ft::false_type) {
+	for (; first != last; ++first)
+		_alloc.construct(first, val);
+}
+
+template <typename T, typename Allocator, typename GrowthPolicy>
+void	vector<T, Allocator, GrowthPolicy>::__destroy(pointer first, pointer last) {
+	for (; first != last; ++first)
+		_alloc.destroy(first);
+}
+
 /* <-- PRIVATE FUNCTIONS END */
 
 